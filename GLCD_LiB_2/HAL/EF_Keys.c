@@ -0,0 +1,256 @@
+/***************************************************************
+ *  Source File: EF_Keys.c
+ *
+ *  Description: interrupt driven key scanner with debouncing, event queue and auto repeat
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include <avr/interrupt.h>
+#include "EF_Keys.h"
+
+/**************************************************
+ * 	global variables
+ *************************************************/
+/* pin of every key, index is (key code - 1) */
+static const U8_t key_bit[NUMBER_OF_KEYS] = {KEY_PREV_BIT, KEY_NEXT_BIT, KEY_SELECT_BIT, KEY_BACK_BIT};
+
+static U8_t integrator[NUMBER_OF_KEYS];		/* 0 .. KEYS_DEBOUNCE_TICKS            */
+static U8_t hold_ticks[NUMBER_OF_KEYS];		/* ticks until the next long/repeat event */
+static U8_t repeat_ticks[NUMBER_OF_KEYS];	/* current repeat interval, shrinks while held */
+static U8_t keys_state;						/* debounced state, bit set = pressed  */
+static volatile U8_t repeat_mask = KEYS_REPEAT_DEFAULT_MASK;
+
+/* single producer (ISR) single consumer (main loop) queue:
+ * only the ISR writes queue_head, only the main loop writes queue_tail */
+static U8_t event_queue[KEYS_QUEUE_SIZE];
+static volatile U8_t queue_head;
+static volatile U8_t queue_tail;
+static volatile U8_t lost_events;
+static void (*eventHookPtr)(void) = NULL;	/* called in the ISR when an event is queued */
+
+/**************************************************
+ * 	local functions
+ *************************************************/
+static void EF_void_Keys_PutEvent(U8_t event)
+{
+	U8_t next = (queue_head + 1) & (KEYS_QUEUE_SIZE - 1);
+
+	if(next == queue_tail)
+	{
+		/* queue is full, drop the newest event */
+		if(lost_events != 0xFF)
+		{
+			lost_events++;
+		}
+		return;
+	}
+	event_queue[queue_head] = event;
+	queue_head = next;
+	if(eventHookPtr != NULL)
+	{
+		eventHookPtr();
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Keys_Init
+*
+* DESCRIPTION : configure the key pins as inputs with pull up, clear the event
+* 				queue and attach EF_void_Keys_Scan() to the system tick.
+* 				EF_void_TimerInit() must be called before.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Keys_Init(void)
+{
+	U8_t index;
+
+	for(index = 0; index < NUMBER_OF_KEYS; index++)
+	{
+		KEYS_DDR  &= ~(1 << key_bit[index]);
+		KEYS_PORT |=  (1 << key_bit[index]);
+		integrator[index] = 0;
+	}
+	keys_state  = 0;
+	queue_head  = 0;
+	queue_tail  = 0;
+	lost_events = 0;
+	EF_void_TimerSetTickHook(EF_void_Keys_Scan);
+}
+
+/****************************************************************************
+* Function    : EF_void_Keys_Scan
+*
+* DESCRIPTION : sample and debounce all keys, put press/release/long press and
+* 				repeat events into the queue. called in the Timer ISR.
+*
+* 				Every key has an integrator which counts up while the pin reads
+* 				pressed and down while it reads released, the debounced state
+* 				changes only at the limits, so bounces shorter than
+* 				KEYS_DEBOUNCE_TICKS are ignored.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Keys_Scan(void)
+{
+	U8_t index;
+	U8_t pins = KEYS_PIN;
+
+	for(index = 0; index < NUMBER_OF_KEYS; index++)
+	{
+		U8_t code = index + 1;
+		U8_t mask = (1 << index);
+
+		/* active low */
+		if((pins & (1 << key_bit[index])) == 0)
+		{
+			if(integrator[index] < KEYS_DEBOUNCE_TICKS)
+			{
+				integrator[index]++;
+			}
+		}
+		else if(integrator[index] > 0)
+		{
+			integrator[index]--;
+		}
+
+		if(!(keys_state & mask))
+		{
+			if(integrator[index] == KEYS_DEBOUNCE_TICKS)
+			{
+				keys_state |= mask;
+				hold_ticks[index]   = KEYS_LONG_PRESS_TICKS;
+				repeat_ticks[index] = KEYS_REPEAT_START_TICKS;
+				EF_void_Keys_PutEvent(KEY_EVENT_PRESS | code);
+			}
+		}
+		else if(integrator[index] == 0)
+		{
+			keys_state &= ~mask;
+			EF_void_Keys_PutEvent(KEY_EVENT_RELEASE | code);
+		}
+		else if(hold_ticks[index] != 0)
+		{
+			/* key is held */
+			if(--hold_ticks[index] == 0)
+			{
+				if(repeat_mask & mask)
+				{
+					/* repeat faster the longer the key is held */
+					EF_void_Keys_PutEvent(KEY_EVENT_REPEAT | code);
+					hold_ticks[index] = repeat_ticks[index];
+					if(repeat_ticks[index] > KEYS_REPEAT_MIN_TICKS)
+					{
+						repeat_ticks[index]--;
+					}
+				}
+				else
+				{
+					/* one long press event, then wait for the release */
+					EF_void_Keys_PutEvent(KEY_EVENT_LONG_PRESS | code);
+				}
+			}
+		}
+	}
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Keys_GetEvent
+*
+* DESCRIPTION : take the oldest event from the queue, called from the main loop.
+*
+* PARAMETERS  : event : pointer to the event (KEY_EVENT_xxx | KEY_xxx)
+*
+* Return Value: TRUE if an event was available.
+*
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_Keys_GetEvent(U8_t *event)
+{
+	U8_t tail = queue_tail;
+
+	if(tail == queue_head)
+	{
+		return FALSE;
+	}
+	*event = event_queue[tail];
+	queue_tail = (tail + 1) & (KEYS_QUEUE_SIZE - 1);
+	return TRUE;
+}
+
+/****************************************************************************
+* Function    : EF_void_Keys_SetRepeat
+*
+* DESCRIPTION : select the keys which repeat while they are held, for example
+* 				only PREV/NEXT in a numeric entry field.
+*
+* PARAMETERS  : keyMask : bit (key code - 1) set for every repeating key
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Keys_SetRepeat(U8_t keyMask)
+{
+	repeat_mask = keyMask;
+}
+
+/****************************************************************************
+* Function    : EF_u8_Keys_GetLostEvents
+*
+* DESCRIPTION : number of events dropped because the queue was full.
+*
+* PARAMETERS  : None.
+*
+* Return Value: lost events, saturates at 255.
+*
+******************************************************************************/
+U8_t EF_u8_Keys_GetLostEvents(void)
+{
+	return lost_events;
+}
+
+/****************************************************************************
+* Function    : EF_void_Keys_SetEventHook
+*
+* DESCRIPTION : attach a function which is called in the Timer ISR each time
+* 				an event is put into the queue, e.g. to wake the task which
+* 				calls EF_BOOLEAN_Keys_GetEvent(). must be short.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Keys_SetEventHook(void (*hook)(void))
+{
+	U8_t sreg = SREG;
+
+	cli();
+	eventHookPtr = hook;
+	SREG = sreg;
+}
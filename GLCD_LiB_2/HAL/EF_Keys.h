@@ -0,0 +1,115 @@
+/***************************************************************
+ *  Source File: EF_Keys.h
+ *
+ *  Description: interrupt driven key scanner with debouncing, event queue and auto repeat
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+#ifndef _KEYS_H__
+#define _KEYS_H__
+
+#include "EF_Keys_cfg.h"
+
+
+/*************************************************
+ * 	 API functions
+ *************************************************/
+
+/****************************************************************************
+* Function    : EF_void_Keys_Init
+*
+* DESCRIPTION : configure the key pins as inputs with pull up, clear the event
+* 				queue and attach EF_void_Keys_Scan() to the system tick.
+* 				EF_void_TimerInit() must be called before.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Keys_Init(void);
+
+/****************************************************************************
+* Function    : EF_void_Keys_Scan
+*
+* DESCRIPTION : sample and debounce all keys, put press/release/long press and
+* 				repeat events into the queue. called in the Timer ISR.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Keys_Scan(void);
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Keys_GetEvent
+*
+* DESCRIPTION : take the oldest event from the queue, called from the main loop.
+*
+* PARAMETERS  : event : pointer to the event (KEY_EVENT_xxx | KEY_xxx)
+*
+* Return Value: TRUE if an event was available.
+*
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_Keys_GetEvent(U8_t *event);
+
+/****************************************************************************
+* Function    : EF_void_Keys_SetRepeat
+*
+* DESCRIPTION : select the keys which repeat while they are held, for example
+* 				only PREV/NEXT in a numeric entry field.
+*
+* PARAMETERS  : keyMask : bit (key code - 1) set for every repeating key
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Keys_SetRepeat(U8_t keyMask);
+
+/****************************************************************************
+* Function    : EF_u8_Keys_GetLostEvents
+*
+* DESCRIPTION : number of events dropped because the queue was full.
+*
+* PARAMETERS  : None.
+*
+* Return Value: lost events, saturates at 255.
+*
+******************************************************************************/
+extern U8_t EF_u8_Keys_GetLostEvents(void);
+
+/****************************************************************************
+* Function    : EF_void_Keys_SetEventHook
+*
+* DESCRIPTION : attach a function which is called in the Timer ISR each time
+* 				an event is put into the queue, e.g. to wake the task which
+* 				calls EF_BOOLEAN_Keys_GetEvent(). must be short.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Keys_SetEventHook(void (*hook)(void));
+
+#endif
@@ -0,0 +1,76 @@
+/***************************************************************
+ *  Source File: EF_Keys_cfg.h
+ *
+ *  Description: interrupt driven key scanner with debouncing, event queue and auto repeat
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#ifndef KEYS_CFG_H_
+#define KEYS_CFG_H_
+
+#include <avr/io.h>
+#include "../Utilities/std_types.h"
+#include "../Utilities/EF_SpechialTIMER.h"
+
+/**************************************************
+ * Definitions
+ **************************************************/
+/* buttons are connected to port D, active low with internal pull up */
+#define KEYS_DDR					DDRD
+#define KEYS_PORT					PORTD
+#define KEYS_PIN					PIND
+
+#define KEY_NEXT_BIT				5
+#define KEY_PREV_BIT				6
+#define KEY_SELECT_BIT				7
+#define KEY_BACK_BIT				4
+
+/* key codes */
+#define KEY_NONE 					0
+#define KEY_PREV 					1
+#define KEY_NEXT 					2
+#define KEY_SELECT 					3
+#define KEY_BACK 					4
+#define NUMBER_OF_KEYS				4		/* PREV, NEXT, SELECT, BACK */
+
+/* event types, the event byte is (type | key code) */
+#define KEY_EVENT_PRESS				0x10
+#define KEY_EVENT_RELEASE			0x20
+#define KEY_EVENT_LONG_PRESS		0x30
+#define KEY_EVENT_REPEAT			0x40
+#define KEY_EVENT_TYPE(event)		((event) & 0xF0)
+#define KEY_EVENT_CODE(event)		((event) & 0x0F)
+
+/* all times in system ticks (SYSTEMTICKTIME ms) */
+#define KEYS_DEBOUNCE_TICKS			2		/* integrator limit: key must be stable this long */
+#define KEYS_LONG_PRESS_TICKS		(500/SYSTEMTICKTIME)	/* long press and first repeat     */
+#define KEYS_REPEAT_START_TICKS		(200/SYSTEMTICKTIME)	/* first repeat interval           */
+#define KEYS_REPEAT_MIN_TICKS		1		/* fastest repeat interval after acceleration */
+
+/* keys with auto repeat, bit (key code - 1), can be changed with EF_void_Keys_SetRepeat() */
+#define KEYS_REPEAT_DEFAULT_MASK	((1<<(KEY_PREV-1)) | (1<<(KEY_NEXT-1)))
+
+/* event queue size, must be a power of two */
+#define KEYS_QUEUE_SIZE				8
+
+#endif
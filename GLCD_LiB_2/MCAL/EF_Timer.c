@@ -34,6 +34,10 @@
  * Global variables
  *************************************************/
 static void (*voidFuncPtr)(void);
+/* number of system ticks since EF_void_Timer_PORTinit() */
+static volatile U32_t SystemTicks = 0;
+/* CPU cycles collected from the fractions of the ticks */
+static U16_t TickRemainder = 0;
 
 
 /****************************************************************************
@@ -48,14 +52,21 @@ static void (*voidFuncPtr)(void);
 void EF_void_Timer_PORTinit(void)
 {
 
-	/* initialize timer 1 , set the prescaler */
-	TIMER_CONTROL_REG = (TIMER_CONTROL_REG & ~ TIMER_PRESCALE_MASK) | TIMER1PRESCALE ;
-	/* reset TCNT1 */
-	TIMER_REG = MAX_U8_t - (U8_t)TIMERCYCLES ;
-	/* enable TCNT1 overflow */
-	TIMSK |= TOIE_MASK;
-	/* TOV1 can be cleared by writing a logic one to its bit location */
-	TIFR  |= TOV_MASK;
+	SystemTicks   = 0;
+	TickRemainder = 0;
+	/* initialize timer 2 in CTC mode, set the prescaler */
+	TIMER_CONTROL_REG = (TIMER_CONTROL_REG & ~(TIMER_PRESCALE_MASK | WGM_MASK))
+			| CTC_MODE_MASK | TIMER1PRESCALE ;
+	/* the first tick is a short one, the next ones are corrected in the ISR */
+	TIMER_COMPARE_REG = (U8_t)(TIMER_TICK_COUNTS - 1);
+	/* reset TCNT2 */
+	TIMER_REG = 0;
+	/* overflow isn't used any more */
+	TIMSK &= ~TOIE2_MASK;
+	/* enable compare match interrupt */
+	TIMSK |= OCIE_MASK;
+	/* OCF2 can be cleared by writing a logic one to its bit location */
+	TIFR  |= OCF_MASK;
 	/* Enable Global interrupt */
 	sei();
 }
@@ -98,27 +109,86 @@ void EF_void_Timer_RemoveTimerISRCallBack(void)
 
 
 /****************************************************************************
-* Function    : ISR(TIMER1_OVF_vect)
+* Function    : EF_u32_Timer_GetTicks
 *
-* DESCRIPTION : Interrupt handler for tcnt1 overflow interrupt
+* DESCRIPTION : get the number of system ticks since EF_void_Timer_PORTinit()
+*
+* PARAMETERS  : None
+*
+* Return Value: ticks of SYSTEMTICKTIME ms
+******************************************************************************/
+U32_t EF_u32_Timer_GetTicks(void)
+{
+	return EF_u32_AtomicRead(&SystemTicks);
+}
+
+
+/****************************************************************************
+* Function    : EF_u32_Micros
+*
+* DESCRIPTION : monotonic micro seconds clock made of the tick count and the
+* 				running timer counter.
+*
+* PARAMETERS  : None
+*
+* Return Value: micro seconds since EF_void_Timer_PORTinit()
+*
+* NOTE        : the resolution is TIMER_US_PER_COUNT (128us at 8MHz, /1024) and
+* 				the value wraps after 2^32 us (~71 minutes), use differences.
+******************************************************************************/
+U32_t EF_u32_Micros(void)
+{
+	U32_t ticks;
+	U8_t  counts;
+	U8_t  sreg = SREG;
+
+	cli();
+	ticks  = SystemTicks;
+	counts = TIMER_REG;
+	/* compare match happened but its ISR didn't run yet, the counter
+	 * is already cleared: read it again after the flag */
+	if (TIFR & OCF_MASK)
+	{
+		counts = TIMER_REG;
+		ticks++;
+	}
+	SREG = sreg;
+
+	return (ticks * TIMER_US_PER_TICK) + ((U32_t)counts * TIMER_US_PER_COUNT);
+}
+
+
+/****************************************************************************
+* Function    : ISR(TIMER2_COMP_vect)
+*
+* DESCRIPTION : Interrupt handler for tcnt2 compare match interrupt, TCNT2 is
+* 				already cleared by the hardware.
 *
 * PARAMETERS  : None
 *
 * Return Value: None
 ******************************************************************************/
 
-ISR(TIMER_OFV_VECTOR)
+ISR(TIMER_COMP_VECTOR)
 
 {
+	SystemTicks++;
+
+	/* choose the length of the running tick: one count more each time the
+	 * collected fractions make a whole count. TCNT2 is still small here so
+	 * the new compare value is reached in this tick. */
+	TickRemainder += TIMER_TICK_REMAINDER;
+	if (TickRemainder >= TIMER_PRESCALE)
+	{
+		TickRemainder -= TIMER_PRESCALE;
+		TIMER_COMPARE_REG = (U8_t)TIMER_TICK_COUNTS;
+	}
+	else
+	{
+		TIMER_COMPARE_REG = (U8_t)(TIMER_TICK_COUNTS - 1);
+	}
+
 	/* if a user function is defined, execute it */
 	if(voidFuncPtr != NULL)
 		voidFuncPtr();
-
-	/* reset TCNT1 */
-	TIMER_REG = MAX_U8_t - (U8_t)TIMERCYCLES ;
-	/* TOV1 can be cleared by writing a logic one to its bit location */
-	TIFR  |= TOV_MASK;
-
-
 }
-
@@ -73,4 +73,32 @@ extern void EF_void_Timer_SetISRCallBack( void (*userFunc)(void) );
 extern void EF_void_Timer_RemoveTimerISRCallBack(void);
 
 
+/****************************************************************************
+* Function    : EF_u32_Timer_GetTicks
+*
+* DESCRIPTION : get the number of system ticks since EF_void_Timer_PORTinit()
+*
+* PARAMETERS  : None
+*
+* Return Value: ticks of SYSTEMTICKTIME ms
+******************************************************************************/
+extern U32_t EF_u32_Timer_GetTicks(void);
+
+
+/****************************************************************************
+* Function    : EF_u32_Micros
+*
+* DESCRIPTION : monotonic micro seconds clock made of the tick count and the
+* 				running timer counter.
+*
+* PARAMETERS  : None
+*
+* Return Value: micro seconds since EF_void_Timer_PORTinit()
+*
+* NOTE        : the resolution is TIMER_US_PER_COUNT (128us at 8MHz, /1024) and
+* 				the value wraps after 2^32 us (~71 minutes), use differences.
+******************************************************************************/
+extern U32_t EF_u32_Micros(void);
+
+
 #endif
@@ -36,11 +36,17 @@
  *************************************************/
 #define TIMER_CONTROL_REG		TCCR2		/* Timer Control Register       */
 #define TIMER_REG				TCNT2		/* Timer Register     		    */
+#define TIMER_COMPARE_REG		OCR2		/* Output Compare Register      */
 #define TOIE2_MASK				0x40		/* Timer2 Interrupt Enable mask */
 #define TOV2_MASK				0x40		/* Timer2 Over Flow flag  mask  */
-#define TOIE_MASK      		    TOIE2_MASK	/* Interrupt Enable bit mask    */
-#define TOV_MASK       		    TOV2_MASK   /* Over Flow flag bit mask      */
-#define TIMER_OFV_VECTOR        TIMER2_OVF_vect
+#define OCIE2_MASK				0x80		/* Timer2 Compare Int. En. mask */
+#define OCF2_MASK				0x80		/* Timer2 Compare flag mask     */
+#define WGM21_MASK				0x08		/* Timer2 CTC mode bit mask     */
+#define WGM_MASK				0x48		/* Timer2 WGM21:WGM20 bit mask  */
+#define OCIE_MASK      		    OCIE2_MASK	/* Interrupt Enable bit mask    */
+#define OCF_MASK       		    OCF2_MASK   /* Compare Match flag bit mask  */
+#define CTC_MODE_MASK			WGM21_MASK	/* Clear Timer on Compare mode  */
+#define TIMER_COMP_VECTOR       TIMER2_COMP_vect
 
 #define TIMER_CLK_STOP			0x00		/* Timer Stopped			    */
 #define TIMER_CLK_DIV1			0x01		/* Timer clocked at F_CPU       */
@@ -78,12 +84,26 @@
 #define CYCLES_PER_5_MLI_S  ((F_CPU/ TIMER_PRESCALE )/200) 				/* system tick is 5 ms    */
 #define CYCLES_PER_10_MLI_S ((F_CPU/ TIMER_PRESCALE )/100) 				/* system tick is 10 ms   */
 #define CYCLES_PER_20_MLI_S ((F_CPU/ TIMER_PRESCALE )/50) 				/* system tick is 20 ms   */
-#define CYCLES_PER_V_MLI_S  ((F_CPU/ TIMER_PRESCALE )/SYSTEMTICKTIME) 	/* system tick variable   */
+#define CYCLES_PER_V_MLI_S  ((F_CPU/ TIMER_PRESCALE )/(1000/SYSTEMTICKTIME)) 	/* system tick variable */
+
+/* the system tick in timer counts is rarely an integer (8MHz/1024 * 20ms = 156.25),
+ * so the compare value is switched between TIMER_TICK_COUNTS-1 and TIMER_TICK_COUNTS
+ * to make the average tick exactly SYSTEMTICKTIME. In CTC mode the counter is
+ * cleared by hardware, the ISR latency doesn't add to the tick. */
+#define TIMER_TICK_CPU_CYCLES	((F_CPU/1000UL) * SYSTEMTICKTIME)			/* CPU cycles per tick     */
+#define TIMER_TICK_COUNTS		(TIMER_TICK_CPU_CYCLES / TIMER_PRESCALE)		/* whole counts per tick   */
+#define TIMER_TICK_REMAINDER	(TIMER_TICK_CPU_CYCLES % TIMER_PRESCALE)		/* CPU cycles left per tick*/
+#define TIMER_US_PER_TICK		(SYSTEMTICKTIME * 1000UL)					/* micro seconds per tick  */
+#define TIMER_US_PER_COUNT		(TIMER_PRESCALE / (F_CPU/1000000))				/* micro seconds per count */
 
 
 
 #define MAX_U8_t		255			/* Max. counts of Timer 8 bit Register  */
 #define MAX_U16_t		65535		/* Max. counts of Timer 16 bit Register */
 
+#if (TIMER_TICK_COUNTS >= MAX_U8_t) || (TIMER_TICK_COUNTS < 2)
+#error "SYSTEMTICKTIME doesn't fit the 8 bit timer with this prescaler"
+#endif
+
 
 #endif
@@ -44,10 +44,170 @@
 /* structure has the addresses of UART Registers */
 const UART_reg_str uart_reg = {&UDR,&UCSRA,&UCSRB,&UCSRC,&UBRRH,&UBRRL};
 
-//static volatile uint8_t  UART_RxBuf[UART_RX_BUFFER_SIZE];
-//static volatile uint8_t  UART_LastRxError;
-//static volatile uint16_t UART_RxHead;
-//static volatile uint16_t UART_RxTail;
+/* transmit ring buffer, head is written by EF_void_UART_PutChar, tail by the UDRE ISR */
+static volatile U8_t  UART_TxBuf[UART_TX_BUFFER_SIZE];
+static volatile U8_t  UART_TxHead;
+static volatile U8_t  UART_TxTail;
+static volatile U8_t  UART_TxHighWaterMark;
+static volatile U16_t UART_TxLostBytes;
+
+/* receive ring buffer, head is written by the RXC ISR, tail by readFromUART */
+static volatile U8_t  UART_RxBuf[UART_RX_BUFFER_SIZE];
+static volatile U8_t  UART_RxHead;
+static volatile U8_t  UART_RxTail;
+static void (*UART_RxHookPtr)(void) = NULL;	/* called in the RXC ISR */
+
+/* frame assembler of EF_BOOLEAN_UART_GetFrame */
+static U8_t    UART_FrameBuf[UART_FRAME_MAX_LENGTH];
+static U8_t    UART_FrameIndex;
+static BOOLEAN UART_FrameDropped;	/* too long, skipped until its end */
+#if UART_FRAME_MODE == UART_FRAME_LENGTH_PREFIX
+static U8_t    UART_FrameLength;
+static BOOLEAN UART_FrameWaitLength;
+#endif
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_UART_TxFull
+*
+* DESCRIPTION : check if there is no free place in the transmit buffer
+*
+* PARAMETERS  : None
+*
+* Return Value: TRUE if full
+******************************************************************************/
+static BOOLEAN EF_BOOLEAN_UART_TxFull(void)
+{
+	return (((UART_TxHead + 1) & UART_TX_BUFFER_MASK) == UART_TxTail);
+}
+
+/****************************************************************************
+* Function    : EF_void_UART_TxEnqueue
+*
+* DESCRIPTION : put one byte in the transmit buffer and enable the UDRE
+* 				interrupt, the buffer must not be full
+*
+* PARAMETERS  : data : TX byte
+*
+* Return Value: None
+******************************************************************************/
+static void EF_void_UART_TxEnqueue(U8_t data)
+{
+	U8_t used;
+
+	UART_TxBuf[UART_TxHead] = data;
+	UART_TxHead = (UART_TxHead + 1) & UART_TX_BUFFER_MASK;
+
+	used = (UART_TxHead - UART_TxTail) & UART_TX_BUFFER_MASK;
+	if (used > UART_TxHighWaterMark)
+	{
+		UART_TxHighWaterMark = used;
+	}
+	/* the ISR disables itself when the buffer is empty */
+	*uart_reg.UCSRB_Reg |= (1 << UDRIE);
+}
+
+/****************************************************************************
+* Function    : EF_void_UART_RxStore
+*
+* DESCRIPTION : put one received byte in the receive buffer, if the buffer
+* 				is full the byte is lost and the overflow flag is set
+*
+* PARAMETERS  : data : RX byte
+*
+* Return Value: None
+******************************************************************************/
+static void EF_void_UART_RxStore(U8_t data)
+{
+	U8_t nextHead = (UART_RxHead + 1) & UART_RX_BUFFER_MASK;
+
+	if (nextHead == UART_RxTail)
+	{
+		isArduinoRXBufferOverFlowed = TRUE;
+	}
+	else
+	{
+		UART_RxBuf[UART_RxHead] = data;
+		UART_RxHead = nextHead;
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_UART_RxPoll
+*
+* DESCRIPTION : without the RXC interrupt the receive buffer is filled here,
+* 				called by all the read functions
+*
+* PARAMETERS  : None
+*
+* Return Value: None
+******************************************************************************/
+static void EF_void_UART_RxPoll(void)
+{
+	if ( (!(*uart_reg.UCSRB_Reg & (1 << RXCIE))) && (*uart_reg.UCSRA_Reg & (1 << RXC)) )
+	{
+		EF_void_UART_RxStore(*uart_reg.UDR_Reg);
+	}
+}
+
+/****************************************************************************
+* Function    : ISR(USART_RXC_vect)
+*
+* DESCRIPTION : Interrupt handler for receive complete, buffers the byte
+*
+* PARAMETERS  : None
+*
+* Return Value: None
+******************************************************************************/
+ISR(USART_RXC_vect)
+{
+	EF_void_UART_RxStore(*uart_reg.UDR_Reg);
+	if (UART_RxHookPtr != NULL)
+	{
+		UART_RxHookPtr();
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_UART_SetRxHook
+*
+* DESCRIPTION : attach a function which is called in the RXC ISR after each
+* 				received byte is buffered, e.g. to wake the reading task.
+* 				must be short, it runs with interrupts disabled.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None
+******************************************************************************/
+void EF_void_UART_SetRxHook(void (*hook)(void))
+{
+	U8_t sreg = SREG;
+
+	cli();
+	UART_RxHookPtr = hook;
+	SREG = sreg;
+}
+
+/****************************************************************************
+* Function    : ISR(USART_UDRE_vect)
+*
+* DESCRIPTION : Interrupt handler for UDR empty, sends the next buffered byte
+*
+* PARAMETERS  : None
+*
+* Return Value: None
+******************************************************************************/
+ISR(USART_UDRE_vect)
+{
+	if (UART_TxHead == UART_TxTail)
+	{
+		*uart_reg.UCSRB_Reg &= ~(1 << UDRIE);
+	}
+	else
+	{
+		*uart_reg.UDR_Reg = UART_TxBuf[UART_TxTail];
+		UART_TxTail = (UART_TxTail + 1) & UART_TX_BUFFER_MASK;
+	}
+}
 /****************************************************************************
 * Function    : EF_void_UART_Init
 *
@@ -59,8 +219,18 @@ const UART_reg_str uart_reg = {&UDR,&UCSRA,&UCSRB,&UCSRC,&UBRRH,&UBRRL};
 ******************************************************************************/
 void EF_void_UART_Init(UART_cfg_str *uart_cfg)
 {
-//    UART_RxHead = 0;
-//    UART_RxTail = 0;
+	UART_RxHead          = 0;
+	UART_RxTail          = 0;
+	UART_FrameIndex      = 0;
+	UART_FrameDropped    = FALSE;
+#if UART_FRAME_MODE == UART_FRAME_LENGTH_PREFIX
+	UART_FrameWaitLength = TRUE;
+#endif
+	isArduinoRXBufferOverFlowed = FALSE;
+	UART_TxHead          = 0;
+	UART_TxTail          = 0;
+	UART_TxHighWaterMark = 0;
+	UART_TxLostBytes     = 0;
 
 
 	/* variable helps in calculating Baud rate */
@@ -83,7 +253,12 @@ void EF_void_UART_Init(UART_cfg_str *uart_cfg)
 		sei();
 	}
 	if (uart_cfg->ReceiverEnable   ) *uart_reg.UCSRB_Reg |= (1 << RXEN);
-	if (uart_cfg->TransmitterEnable) *uart_reg.UCSRB_Reg |= (1 << TXEN);
+	if (uart_cfg->TransmitterEnable)
+	{
+		/* transmitting is done by the UDRE interrupt */
+		*uart_reg.UCSRB_Reg |= (1 << TXEN);
+		sei();
+	}
 	/* Parity and Stop bit*/
 	*uart_reg.UCSRC_Reg |= (uart_cfg->parity)<<UPM0;
 	*uart_reg.UCSRC_Reg |= (uart_cfg->stopBits)<<USBS;
@@ -115,7 +290,7 @@ void EF_void_UART_Init(UART_cfg_str *uart_cfg)
 /****************************************************************************
 * Function    : EF_BOOLEAN_UART_GetChar
 *
-* DESCRIPTION : Getting the RX byte ,used timer to be unStuck
+* DESCRIPTION : Getting the RX byte from the receive buffer ,used timer to be unStuck
 *
 * PARAMETERS  : returnedValue: pointer to the Rx byte
 *
@@ -131,37 +306,36 @@ BOOLEAN EF_BOOLEAN_UART_GetChar(U8_t * returnedValue)
 	EF_void_TimerStart(UART_TIMER_ID);
 
 	/* make UART unstuck*/
-    while( (!(*uart_reg.UCSRA_Reg & (1 << RXC))) && (!EF_BOOLEAN_TimerCheck(UART_TIMER_ID)) );
+    while( (!EF_BOOLEAN_UART_CheckForRxData()) && (!EF_BOOLEAN_TimerCheck(UART_TIMER_ID)) );
     /* extracting from the previous loop because of receiving byte or Time out*/
     EF_void_TimerStop(UART_TIMER_ID);
     EF_void_TimerReset(UART_TIMER_ID);
 
-    reciveFlag     = TRUE;
-
-    if(!(*uart_reg.UCSRA_Reg & (1 << RXC)))
+    if(EF_BOOLEAN_UART_CheckForRxData())
     {
-    	reciveFlag = FALSE;
+    	*returnedValue = (U8_t)readFromUART();
+    	reciveFlag     = TRUE;
     }
-
-    *returnedValue = *uart_reg.UDR_Reg;
     return reciveFlag;
 }
 
 
 BOOLEAN EF_BOOLEAN_UART_CheckForRxData( )
 {
-    /*Returns true if there is data in the receive FIFO or false if there is no data in the receive FIFO.*/
-    return ( (*uart_reg.UCSRA_Reg & (1 << RXC)) >> RXC );
+    /*Returns true if there is data in the receive buffer or false if there is no data in the receive buffer.*/
+	EF_void_UART_RxPoll();
+    return (UART_RxHead != UART_RxTail);
 }
 
 /****************************************************************************
 * Function    : EF_BOOLEAN_UART_PutChar
 *
-* DESCRIPTION : Sending the TX byte ,used timer to be unStuck
+* DESCRIPTION : put the TX byte in the transmit buffer, waits for a free place
+* 				with a timer to be unStuck
 *
 * PARAMETERS  : data : TX byte
 *
-* Return Value: return True if Byte is transmitted or false
+* Return Value: return True if Byte is buffered or false
 *
 * NOTE		  : special timer must be initialized and enable Global interrupt
 * 			    before using this function
@@ -172,15 +346,14 @@ BOOLEAN EF_BOOLEAN_UART_PutChar(U8_t data)
 	EF_void_TimerStart(UART_TIMER_ID);
 
 	/* make UART unstuck */
-    while( (!(*uart_reg.UCSRA_Reg & (1 << UDRE))) && (!EF_BOOLEAN_TimerCheck(UART_TIMER_ID)) );
-    /* extracting from the previous loop because of receiving byte or Time out*/
+    while( EF_BOOLEAN_UART_TxFull() && (!EF_BOOLEAN_TimerCheck(UART_TIMER_ID)) );
+    /* extracting from the previous loop because of free place or Time out*/
     EF_void_TimerStop(UART_TIMER_ID);
     EF_void_TimerReset(UART_TIMER_ID);
 
-	if(*uart_reg.UCSRA_Reg & (1 << UDRE))
+	if(!EF_BOOLEAN_UART_TxFull())
 	{
-		/* USART Transmit Complete */
-		*uart_reg.UDR_Reg = data;    /* send character */
+		EF_void_UART_TxEnqueue(data);
 		sendFlag = TRUE;
 	}
 	else
@@ -200,25 +373,181 @@ BOOLEAN EF_BOOLEAN_UART_PutChar(U8_t data)
 ******************************************************************************/
 U8_t EF_u8_UART_WaitChar()
 {
+	int16_t data;
+
 	/* wait until receive byte */
-    while((!(*uart_reg.UCSRA_Reg & (1 << RXC))) );
-    return *uart_reg.UDR_Reg;
+    while((data = readFromUART()) == UART_NO_DATA);
+    return (U8_t)data;
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_UART_GetFrame
+*
+* DESCRIPTION : takes the received bytes without waiting and assembles them
+* 				to frames as selected by UART_FRAME_MODE. Frames longer than
+* 				UART_FRAME_MAX_LENGTH are dropped.
+*
+* PARAMETERS  : frame  : UART_FRAME_MAX_LENGTH bytes, gets the complete frame
+* 				length : gets the number of frame bytes
+*
+* Return Value: TRUE if a complete frame is returned, FALSE if not yet
+*
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_UART_GetFrame(U8_t *frame, U8_t *length)
+{
+	BOOLEAN frameComplete = FALSE;
+	int16_t data;
+
+	while (frameComplete == FALSE && (data = readFromUART()) != UART_NO_DATA)
+	{
+#if UART_FRAME_MODE == UART_FRAME_LENGTH_PREFIX
+		if (UART_FrameWaitLength == TRUE)
+		{
+			UART_FrameLength     = (U8_t)data;
+			UART_FrameIndex      = 0;
+			UART_FrameDropped    = (UART_FrameLength > UART_FRAME_MAX_LENGTH);
+			UART_FrameWaitLength = FALSE;
+		}
+		else
+		{
+			if (UART_FrameDropped == FALSE)
+			{
+				UART_FrameBuf[UART_FrameIndex] = (U8_t)data;
+			}
+			UART_FrameIndex++;
+		}
+
+		if (UART_FrameWaitLength == FALSE && UART_FrameIndex == UART_FrameLength)
+		{
+			UART_FrameWaitLength = TRUE;
+			frameComplete = !UART_FrameDropped;
+		}
+#else
+		if (data == UART_FRAME_DELIMITER)
+		{
+			frameComplete     = !UART_FrameDropped;
+			UART_FrameDropped = FALSE;
+		}
+		else if (UART_FrameIndex < UART_FRAME_MAX_LENGTH)
+		{
+			UART_FrameBuf[UART_FrameIndex++] = (U8_t)data;
+		}
+		else
+		{
+			UART_FrameDropped = TRUE;
+		}
+
+		if (data == UART_FRAME_DELIMITER && frameComplete == FALSE)
+		{
+			UART_FrameIndex = 0;
+		}
+#endif
+	}
+
+	if (frameComplete == TRUE)
+	{
+		memcpy(frame, UART_FrameBuf, UART_FrameIndex);
+		*length = UART_FrameIndex;
+#if UART_FRAME_MODE != UART_FRAME_LENGTH_PREFIX
+		UART_FrameIndex = 0;
+#endif
+	}
+	return frameComplete;
 }
 
 /****************************************************************************
 * Function    : EF_void_UART_PutChar
 *
-* DESCRIPTION : Sending the TX byte
+* DESCRIPTION : put the TX byte in the transmit buffer and return, if the
+* 				buffer is full UART_TX_OVERFLOW_POLICY is applied
 *
 * PARAMETERS  : Tx_byte
 *
 * Return Value: None
 *
+* NOTE		  : with UART_TX_OVERFLOW_BLOCK don't call it while the global
+* 				interrupt is disabled
 ******************************************************************************/
 void EF_void_UART_PutChar(U8_t data)
 {
-	while(!(*uart_reg.UCSRA_Reg & (1 << UDRE)));  /* wait until UDR ready */
-	*uart_reg.UDR_Reg = data;    				  /* send character 	  */
+#if UART_TX_OVERFLOW_POLICY == UART_TX_OVERFLOW_OVERWRITE
+	U8_t sreg;
+#endif
+
+	if (EF_BOOLEAN_UART_TxFull())
+	{
+#if UART_TX_OVERFLOW_POLICY == UART_TX_OVERFLOW_DROP
+		UART_TxLostBytes++;
+		return;
+#elif UART_TX_OVERFLOW_POLICY == UART_TX_OVERFLOW_BLOCK
+		while (EF_BOOLEAN_UART_TxFull());	/* wait until the ISR sent one byte */
+#else
+		/* the ISR moves the tail too */
+		sreg = SREG;
+		cli();
+		if (EF_BOOLEAN_UART_TxFull())
+		{
+			UART_TxTail = (UART_TxTail + 1) & UART_TX_BUFFER_MASK;
+			UART_TxLostBytes++;
+		}
+		SREG = sreg;
+#endif
+	}
+	EF_void_UART_TxEnqueue(data);
+}
+
+/****************************************************************************
+* Function    : EF_u8_UART_GetTxHighWaterMark
+*
+* DESCRIPTION : the maximum number of bytes that waited in the transmit
+* 				buffer since EF_void_UART_Init
+*
+* PARAMETERS  : None
+*
+* Return Value: U8_t : max. used places, UART_TX_BUFFER_SIZE - 1 means full
+*
+******************************************************************************/
+U8_t EF_u8_UART_GetTxHighWaterMark(void)
+{
+	return UART_TxHighWaterMark;
+}
+
+/****************************************************************************
+* Function    : EF_u8_UART_GetTxFree
+*
+* DESCRIPTION : the number of bytes which can be put in the transmit buffer
+* 				without waiting or losing bytes
+*
+* PARAMETERS  : None
+*
+* Return Value: U8_t : free places
+*
+******************************************************************************/
+U8_t EF_u8_UART_GetTxFree(void)
+{
+	return (UART_TxTail - UART_TxHead - 1) & UART_TX_BUFFER_MASK;
+}
+
+/****************************************************************************
+* Function    : EF_u16_UART_GetTxLostBytes
+*
+* DESCRIPTION : the number of bytes lost because the transmit buffer was full,
+* 				always 0 with UART_TX_OVERFLOW_BLOCK
+*
+* PARAMETERS  : None
+*
+* Return Value: U16_t : lost bytes since EF_void_UART_Init
+*
+******************************************************************************/
+U16_t EF_u16_UART_GetTxLostBytes(void)
+{
+	U16_t lostBytes;
+	U8_t  sreg = SREG;
+
+	cli();
+	lostBytes = UART_TxLostBytes;
+	SREG = sreg;
+	return lostBytes;
 }
 
 /****************************************************************************
@@ -324,6 +653,41 @@ void EF_void_UART_SendString(char *array)
 
 
 
+/****************************************************************************
+* Function    : readFromUART
+*
+* DESCRIPTION : take one byte from the receive buffer without waiting
+*
+* PARAMETERS  : None
+*
+* Return Value: the received byte or UART_NO_DATA
+*
+******************************************************************************/
+int16_t readFromUART()
+{
+	U8_t data;
+
+	EF_void_UART_RxPoll();
+	if (UART_RxHead == UART_RxTail)
+	{
+		return UART_NO_DATA;
+	}
+	data = UART_RxBuf[UART_RxTail];
+	UART_RxTail = (UART_RxTail + 1) & UART_RX_BUFFER_MASK;
+	return data;
+}
+
+int16_t getAvailableDataCountOnUART()
+{
+	EF_void_UART_RxPoll();
+	return (UART_RxHead - UART_RxTail) & UART_RX_BUFFER_MASK;
+}
+
+uint8_t getIsArduinoRXBufferEmptyFlag()
+{
+	return (getAvailableDataCountOnUART() == 0);
+}
+
 uint8_t getIsArduinoRXBufferOverFlowedFlag()
 {
     return isArduinoRXBufferOverFlowed;
@@ -28,7 +28,7 @@
 #define UART_H
 
 #include "EF_UART_cfg.h"
-#define UART_RX_BUFFER_SIZE     256
+#define UART_RX_BUFFER_SIZE     64              /**< power of 2, max. 128        */
 #define UART_RX_BUFFER_MASK     (UART_RX_BUFFER_SIZE - 1)
 //Error codes
 #define UART_NO_DATA            -1              /**< no receive data available   */
@@ -51,11 +51,12 @@ extern void EF_void_UART_Init(UART_cfg_str *uart_cfg);
 /****************************************************************************
 * Function    : EF_BOOLEAN_UART_PutChar
 *
-* DESCRIPTION : Sending the TX byte ,used timer to be unStuck
+* DESCRIPTION : put the TX byte in the transmit buffer, waits for a free place
+* 				with a timer to be unStuck
 *
 * PARAMETERS  : data : TX byte
 *
-* Return Value: return True if Byte is transmitted or false
+* Return Value: return True if Byte is buffered or false
 *
 * NOTE		  : special timer must be initialized and enable Global interrupt
 * 			    before using this function
@@ -77,6 +78,15 @@ extern BOOLEAN EF_BOOLEAN_UART_PutChar(U8_t data);
 extern BOOLEAN EF_BOOLEAN_UART_GetChar(U8_t * returnedValue);
 
 
+/****************************************************************************
+* Function    : EF_BOOLEAN_UART_CheckForRxData
+*
+* DESCRIPTION : check the receive buffer
+*
+* PARAMETERS  : None
+*
+* Return Value: return True if there is a received byte
+******************************************************************************/
 extern BOOLEAN EF_BOOLEAN_UART_CheckForRxData( );
 /****************************************************************************
 * Function    : EF_u8_UART_WaitChar
@@ -88,17 +98,87 @@ extern BOOLEAN EF_BOOLEAN_UART_CheckForRxData( );
 * Return Value: U8_t : Rx byte
 ******************************************************************************/
 extern U8_t EF_u8_UART_WaitChar();
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_UART_GetFrame
+*
+* DESCRIPTION : takes the received bytes without waiting and assembles them
+* 				to frames as selected by UART_FRAME_MODE. Frames longer than
+* 				UART_FRAME_MAX_LENGTH are dropped.
+*
+* PARAMETERS  : frame  : UART_FRAME_MAX_LENGTH bytes, gets the complete frame
+* 				length : gets the number of frame bytes
+*
+* Return Value: TRUE if a complete frame is returned, FALSE if not yet
+*
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_UART_GetFrame(U8_t *frame, U8_t *length);
 /****************************************************************************
 * Function    : EF_void_UART_PutChar
 *
-* DESCRIPTION : Sending the TX byte
+* DESCRIPTION : put the TX byte in the transmit buffer and return, if the
+* 				buffer is full UART_TX_OVERFLOW_POLICY is applied
 *
 * PARAMETERS  : Tx_byte
 *
 * Return Value: None
 *
+* NOTE		  : with UART_TX_OVERFLOW_BLOCK don't call it while the global
+* 				interrupt is disabled
 ******************************************************************************/
 extern void EF_void_UART_PutChar(U8_t data);
+
+/****************************************************************************
+* Function    : EF_u8_UART_GetTxHighWaterMark
+*
+* DESCRIPTION : the maximum number of bytes that waited in the transmit
+* 				buffer since EF_void_UART_Init
+*
+* PARAMETERS  : None
+*
+* Return Value: U8_t : max. used places, UART_TX_BUFFER_SIZE - 1 means full
+*
+******************************************************************************/
+extern U8_t EF_u8_UART_GetTxHighWaterMark(void);
+
+/****************************************************************************
+* Function    : EF_u8_UART_GetTxFree
+*
+* DESCRIPTION : the number of bytes which can be put in the transmit buffer
+* 				without waiting or losing bytes
+*
+* PARAMETERS  : None
+*
+* Return Value: U8_t : free places
+*
+******************************************************************************/
+extern U8_t EF_u8_UART_GetTxFree(void);
+
+/****************************************************************************
+* Function    : EF_u16_UART_GetTxLostBytes
+*
+* DESCRIPTION : the number of bytes lost because the transmit buffer was full,
+* 				always 0 with UART_TX_OVERFLOW_BLOCK
+*
+* PARAMETERS  : None
+*
+* Return Value: U16_t : lost bytes since EF_void_UART_Init
+*
+******************************************************************************/
+extern U16_t EF_u16_UART_GetTxLostBytes(void);
+
+/****************************************************************************
+* Function    : EF_void_UART_SetRxHook
+*
+* DESCRIPTION : attach a function which is called in the RXC ISR after each
+* 				received byte is buffered, e.g. to wake the reading task.
+* 				must be short, it runs with interrupts disabled.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None
+******************************************************************************/
+extern void EF_void_UART_SetRxHook(void (*hook)(void));
 /****************************************************************************
 * Function    : EF_void_UART_SendArray
 *
@@ -127,9 +207,9 @@ void EF_void_UART_SendString(char *array);
 
 
 /**
- * @brief Receives a byte from serial port 0.
+ * @brief Receives a byte from serial port 0 without waiting.
  * @param None.
- * @return the received byte.
+ * @return the received byte or UART_NO_DATA.
  */
 int16_t  readFromUART();
 /**
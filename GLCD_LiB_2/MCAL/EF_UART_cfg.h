@@ -43,6 +43,30 @@
 
 #define NUMBER_OF_BITS_8 8
 
+/**************************************************
+ * transmit buffer configuration
+ **************************************************/
+/* bytes are sent by the UDRE interrupt, size must be a power of 2 (max. 128),
+ * one place is always kept free */
+#define UART_TX_BUFFER_SIZE     128
+#define UART_TX_BUFFER_MASK     (UART_TX_BUFFER_SIZE - 1)
+
+/* what EF_void_UART_PutChar does when the transmit buffer is full */
+#define UART_TX_OVERFLOW_DROP       0   /* the new byte is lost                   */
+#define UART_TX_OVERFLOW_BLOCK      1   /* wait until the interrupt sent one byte */
+#define UART_TX_OVERFLOW_OVERWRITE  2   /* the oldest byte is lost                */
+#define UART_TX_OVERFLOW_POLICY     UART_TX_OVERFLOW_BLOCK
+
+/**************************************************
+ * receive frame configuration
+ **************************************************/
+/* how EF_BOOLEAN_UART_GetFrame finds the end of a frame */
+#define UART_FRAME_DELIMITED        0   /* ends with UART_FRAME_DELIMITER, not stored */
+#define UART_FRAME_LENGTH_PREFIX    1   /* first byte is the number of frame bytes    */
+#define UART_FRAME_MODE             UART_FRAME_DELIMITED
+#define UART_FRAME_DELIMITER        '\n'
+#define UART_FRAME_MAX_LENGTH       32
+
 /**************************************************
  * configuration types
  *************************************************/
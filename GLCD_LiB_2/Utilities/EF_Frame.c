@@ -0,0 +1,227 @@
+/***************************************************************
+ *  Source File: EF_Frame.c
+ *
+ *  Description: binary messages to the host: SLIP framing, CRC-16 and varints
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include "EF_Frame.h"
+
+/**************************************************
+ * 	global variables
+ *************************************************/
+/* CRC of the frame that is built */
+static U16_t frame_crc;
+/* bytes on the wire of the frame that is built */
+static U16_t frame_length;
+
+/**************************************************
+ * 	local functions
+ *************************************************/
+/* send one frame byte, END and ESC are escaped */
+static void EF_void_Frame_PutEscaped(U8_t data)
+{
+	if(data == FRAME_SLIP_END)
+	{
+		FRAME_PUT_CHAR(FRAME_SLIP_ESC);
+		FRAME_PUT_CHAR(FRAME_SLIP_ESC_END);
+		frame_length += 2;
+	}
+	else if(data == FRAME_SLIP_ESC)
+	{
+		FRAME_PUT_CHAR(FRAME_SLIP_ESC);
+		FRAME_PUT_CHAR(FRAME_SLIP_ESC_ESC);
+		frame_length += 2;
+	}
+	else
+	{
+		FRAME_PUT_CHAR(data);
+		frame_length++;
+	}
+}
+
+static void EF_void_Frame_CrcUpdate(U8_t data)
+{
+	U8_t bit;
+
+	frame_crc ^= (U16_t)data << 8;
+	for(bit = 0; bit < 8; bit++)
+	{
+		if(frame_crc & 0x8000)
+		{
+			frame_crc = (frame_crc << 1) ^ FRAME_CRC_POLYNOMIAL;
+		}
+		else
+		{
+			frame_crc <<= 1;
+		}
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Frame_Begin
+*
+* DESCRIPTION : start a new frame, the bytes are encoded and sent while the
+* 				frame is built, nothing is stored.
+*
+* PARAMETERS  : type : FRAME_TYPE_xxx
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Frame_Begin(U8_t type)
+{
+	/* a leading END flushes line noise at the receiver */
+	FRAME_PUT_CHAR(FRAME_SLIP_END);
+	frame_length = 1;
+	frame_crc    = FRAME_CRC_INIT;
+	EF_void_Frame_PutByte(type);
+}
+
+/****************************************************************************
+* Function    : EF_void_Frame_PutByte
+*
+* DESCRIPTION : add one payload byte.
+*
+* PARAMETERS  : data : payload byte
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Frame_PutByte(U8_t data)
+{
+	EF_void_Frame_CrcUpdate(data);
+	EF_void_Frame_PutEscaped(data);
+}
+
+/****************************************************************************
+* Function    : EF_void_Frame_PutVarint
+*
+* DESCRIPTION : add an unsigned integer as varint: 7 bits per byte, least
+* 				significant group first, bit 7 set if more bytes follow.
+* 				values below 128 take one byte.
+*
+* PARAMETERS  : value : the integer
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Frame_PutVarint(U32_t value)
+{
+	while(value >= 0x80)
+	{
+		EF_void_Frame_PutByte((U8_t)value | 0x80);
+		value >>= 7;
+	}
+	EF_void_Frame_PutByte((U8_t)value);
+}
+
+/****************************************************************************
+* Function    : EF_void_Frame_PutString
+*
+* DESCRIPTION : add the characters of a string without the terminating 0.
+*
+* PARAMETERS  : string : 0 terminated text
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Frame_PutString(const char *string)
+{
+	while(*string != '\0')
+	{
+		EF_void_Frame_PutByte((U8_t)*string++);
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Frame_End
+*
+* DESCRIPTION : add the CRC and close the frame.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Frame_End(void)
+{
+	U16_t crc = frame_crc;
+
+	EF_void_Frame_PutEscaped((U8_t)(crc >> 8));
+	EF_void_Frame_PutEscaped((U8_t)crc);
+	FRAME_PUT_CHAR(FRAME_SLIP_END);
+	frame_length++;
+}
+
+/****************************************************************************
+* Function    : EF_u16_Frame_GetLength
+*
+* DESCRIPTION : the number of bytes sent for the last frame, with the SLIP
+* 				escapes and both END bytes.
+*
+* PARAMETERS  : None.
+*
+* Return Value: bytes on the wire.
+*
+******************************************************************************/
+U16_t EF_u16_Frame_GetLength(void)
+{
+	return frame_length;
+}
+
+/****************************************************************************
+* Function    : EF_void_Frame_SendEvent
+*
+* DESCRIPTION : send a complete FRAME_TYPE_EVENT frame.
+*
+* PARAMETERS  : event : FRAME_EVENT_xxx
+* 				value : event value
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Frame_SendEvent(U8_t event, U32_t value)
+{
+	EF_void_Frame_Begin(FRAME_TYPE_EVENT);
+	EF_void_Frame_PutVarint(event);
+	EF_void_Frame_PutVarint(value);
+	EF_void_Frame_End();
+}
+
+/****************************************************************************
+* Function    : EF_void_Frame_SendLog
+*
+* DESCRIPTION : send a complete FRAME_TYPE_LOG frame.
+*
+* PARAMETERS  : string : 0 terminated text
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Frame_SendLog(const char *string)
+{
+	EF_void_Frame_Begin(FRAME_TYPE_LOG);
+	EF_void_Frame_PutString(string);
+	EF_void_Frame_End();
+}
@@ -0,0 +1,137 @@
+/***************************************************************
+ *  Source File: EF_Frame.h
+ *
+ *  Description: binary messages to the host: SLIP framing, CRC-16 and varints
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+#ifndef _FRAME_H__
+#define _FRAME_H__
+
+#include "EF_Frame_cfg.h"
+
+/*************************************************
+ * 	 API functions
+ *************************************************/
+
+/****************************************************************************
+* Function    : EF_void_Frame_Begin
+*
+* DESCRIPTION : start a new frame, the bytes are encoded and sent while the
+* 				frame is built, nothing is stored.
+*
+* PARAMETERS  : type : FRAME_TYPE_xxx
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Frame_Begin(U8_t type);
+
+/****************************************************************************
+* Function    : EF_void_Frame_PutByte
+*
+* DESCRIPTION : add one payload byte.
+*
+* PARAMETERS  : data : payload byte
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Frame_PutByte(U8_t data);
+
+/****************************************************************************
+* Function    : EF_void_Frame_PutVarint
+*
+* DESCRIPTION : add an unsigned integer as varint: 7 bits per byte, least
+* 				significant group first, bit 7 set if more bytes follow.
+* 				values below 128 take one byte.
+*
+* PARAMETERS  : value : the integer
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Frame_PutVarint(U32_t value);
+
+/****************************************************************************
+* Function    : EF_void_Frame_PutString
+*
+* DESCRIPTION : add the characters of a string without the terminating 0.
+*
+* PARAMETERS  : string : 0 terminated text
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Frame_PutString(const char *string);
+
+/****************************************************************************
+* Function    : EF_void_Frame_End
+*
+* DESCRIPTION : add the CRC and close the frame.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Frame_End(void);
+
+/****************************************************************************
+* Function    : EF_u16_Frame_GetLength
+*
+* DESCRIPTION : the number of bytes sent for the last frame, with the SLIP
+* 				escapes and both END bytes.
+*
+* PARAMETERS  : None.
+*
+* Return Value: bytes on the wire.
+*
+******************************************************************************/
+extern U16_t EF_u16_Frame_GetLength(void);
+
+/****************************************************************************
+* Function    : EF_void_Frame_SendEvent
+*
+* DESCRIPTION : send a complete FRAME_TYPE_EVENT frame.
+*
+* PARAMETERS  : event : FRAME_EVENT_xxx
+* 				value : event value
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Frame_SendEvent(U8_t event, U32_t value);
+
+/****************************************************************************
+* Function    : EF_void_Frame_SendLog
+*
+* DESCRIPTION : send a complete FRAME_TYPE_LOG frame.
+*
+* PARAMETERS  : string : 0 terminated text
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Frame_SendLog(const char *string);
+
+#endif
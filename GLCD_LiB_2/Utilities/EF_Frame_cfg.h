@@ -0,0 +1,65 @@
+/***************************************************************
+ *  Source File: EF_Frame_cfg.h
+ *
+ *  Description: binary messages to the host: SLIP framing, CRC-16 and varints
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#ifndef FRAME_CFG_H_
+#define FRAME_CFG_H_
+
+#include "std_types.h"
+#include "../MCAL/EF_UART.h"
+
+/**************************************************
+ * Definitions
+ **************************************************/
+/* frame on the wire (SLIP, RFC 1055):
+ * END | type | payload | crc16 MSB | crc16 LSB | END
+ * END and ESC inside the frame are sent as ESC ESC_END / ESC ESC_ESC.
+ * crc16: CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of type and payload */
+#define FRAME_SLIP_END				0xC0
+#define FRAME_SLIP_ESC				0xDB
+#define FRAME_SLIP_ESC_END			0xDC
+#define FRAME_SLIP_ESC_ESC			0xDD
+
+#define FRAME_CRC_INIT				0xFFFF
+#define FRAME_CRC_POLYNOMIAL		0x1021
+
+/* output of the encoded bytes */
+#define FRAME_PUT_CHAR(data)		EF_void_UART_PutChar(data)
+
+/* message types */
+#define FRAME_TYPE_LOG				0x01	/* payload: text, no terminating 0             */
+#define FRAME_TYPE_EVENT			0x02	/* payload: varint FRAME_EVENT_xxx, varint value */
+#define FRAME_TYPE_TELEMETRY		0x03	/* payload: pairs of varint id, varint value    */
+#define FRAME_TYPE_PAGE				0x04	/* payload: varint y0, varint lines, varint width,
+											   page buffer PackBits compressed            */
+#define FRAME_TYPE_FRAME_END		0x05	/* payload: varint bytes of the frame,
+											   varint pages not sent                      */
+
+/* event IDs of FRAME_TYPE_EVENT */
+#define FRAME_EVENT_KEY				0x01	/* value: KEY_EVENT_xxx | KEY_xxx               */
+#define FRAME_EVENT_CHECK_RESULT	0x02	/* value: TRANSACTION_xxx                       */
+
+#endif
@@ -0,0 +1,726 @@
+/***************************************************************
+ *  Source File: EF_Menu.c
+ *
+ *  Description: table driven menu engine, menu tables in program memory and partial redraw
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include "EF_Menu.h"
+
+/**************************************************
+ * 	global variables
+ *************************************************/
+static u8g_t *menu_u8g;
+static const MENU_node_str *menu_stack[MENU_MAX_DEPTH];	/* [0] is the root menu */
+static U8_t menu_depth;					/* index of the current menu in menu_stack */
+static U8_t menu_current;				/* selected item                           */
+static U8_t menu_drawn;					/* selected item of the last complete frame */
+static U8_t menu_top;					/* first visible item, scroll offset        */
+static U8_t menu_drawn_top;				/* first visible item of the last complete frame */
+
+/* display lines which must be written by the next frame, collected until a frame
+ * is complete, so lines of an interrupted frame are written again. Two separate
+ * areas are kept, a selection which wraps around marks the first and the last
+ * row without the rows between them. An unused area has y0 > y1. */
+#define MENU_DIRTY_AREAS	2
+static BOOLEAN full_redraw;
+static u8g_uint_t dirty_y0[MENU_DIRTY_AREAS];
+static u8g_uint_t dirty_y1[MENU_DIRTY_AREAS];
+
+static BOOLEAN frame_pending;			/* frame started, not all pages written */
+static BOOLEAN display_valid;			/* display shows the last complete frame */
+
+/* screen shown instead of the menu and its background task */
+static u8g_draw_fn screen_draw;			/* NULL: the menu is shown                  */
+static MENU_task_t screen_task;			/* NULL: no task is running                 */
+static const MENU_node_str *task_next;	/* entered MENU_RESULT_TICKS after the task  */
+static BOOLEAN spinner_on;
+static U8_t spinner_frame;
+
+/* dot positions of the spinner, the dot of the current frame is drawn bold */
+static const U8_t spinner_dots[8][2] PROGMEM = {
+	{3, 0}, {5, 1}, {6, 3}, {5, 5}, {3, 6}, {1, 5}, {0, 3}, {1, 1}
+};
+
+/**************************************************
+ * 	local functions
+ *************************************************/
+#define MENU_NODE()			(menu_stack[menu_depth])
+#define MENU_READ_PTR(adr)	((const void *)pgm_read_word(adr))
+
+static void EF_void_Menu_SetFont(u8g_t *u8g)
+{
+	u8g_SetFontRefHeightText(u8g);
+	u8g_SetDefaultForegroundColor(u8g);
+	u8g_SetFontPosTop(u8g);
+}
+
+/* height of an item row, the menu font setup is applied */
+static U8_t EF_u8_Menu_RowHeight(u8g_t *u8g)
+{
+	EF_void_Menu_SetFont(u8g);
+	return u8g_GetFontAscent(u8g) - u8g_GetFontDescent(u8g);
+}
+
+/* upper line of the first item row, same row boxes as u8g_DrawStrInverseP() */
+static u8g_uint_t EF_u8g_Menu_ListTop(u8g_t *u8g, U8_t h)
+{
+	return MENU_FIRST_ITEM_ROW*h + u8g->font_calc_vref(u8g) - u8g_GetFontAscent(u8g);
+}
+
+/* number of item rows which fit on the display below the title */
+static U8_t EF_u8_Menu_VisibleRows(void)
+{
+	U8_t h = EF_u8_Menu_RowHeight(menu_u8g);
+	U8_t rows = (u8g_GetHeight(menu_u8g) - EF_u8g_Menu_ListTop(menu_u8g, h)) / h;
+
+	if(rows == 0)
+	{
+		rows = 1;
+	}
+	return rows;
+}
+
+/* move the visible window so that the selected item is on the screen */
+static void EF_void_Menu_ScrollToSelection(void)
+{
+	U8_t rows = EF_u8_Menu_VisibleRows();
+
+	if(menu_current < menu_top)
+	{
+		menu_top = menu_current;
+	}
+	else if(menu_current >= menu_top + rows)
+	{
+		menu_top = menu_current - rows + 1;
+	}
+}
+
+/* extend dirty area "index" by the lines y0..y1 */
+static void EF_void_Menu_MergeArea(U8_t index, u8g_uint_t y0, u8g_uint_t y1)
+{
+	if(y0 < dirty_y0[index])
+	{
+		dirty_y0[index] = y0;
+	}
+	if(y1 > dirty_y1[index])
+	{
+		dirty_y1[index] = y1;
+	}
+}
+
+static void EF_void_Menu_MarkArea(u8g_uint_t y, u8g_uint_t h)
+{
+	u8g_uint_t y1 = y + h - 1;
+	U8_t index;
+
+	for(index = 0; index < MENU_DIRTY_AREAS; index++)
+	{
+		if(dirty_y0[index] > dirty_y1[index])
+		{
+			/* unused area */
+			dirty_y0[index] = y;
+			dirty_y1[index] = y1;
+			return;
+		}
+		if(y <= dirty_y1[index] + 1 && y1 + 1 >= dirty_y0[index])
+		{
+			/* overlaps or touches the area */
+			break;
+		}
+	}
+	if(index == MENU_DIRTY_AREAS)
+	{
+		/* no free area left: grow the last one */
+		index = MENU_DIRTY_AREAS - 1;
+	}
+	EF_void_Menu_MergeArea(index, y, y1);
+
+	/* the first area may now overlap the second one */
+	if(dirty_y0[1] <= dirty_y1[1] && dirty_y0[1] <= dirty_y1[0] + 1 && dirty_y1[1] + 1 >= dirty_y0[0])
+	{
+		EF_void_Menu_MergeArea(0, dirty_y0[1], dirty_y1[1]);
+		dirty_y0[1] = (u8g_uint_t)~(u8g_uint_t)0;
+		dirty_y1[1] = 0;
+	}
+}
+
+/* row 0 is the first visible item */
+static void EF_void_Menu_MarkRow(U8_t row)
+{
+	U8_t h = EF_u8_Menu_RowHeight(menu_u8g);
+	EF_void_Menu_MarkArea(EF_u8g_Menu_ListTop(menu_u8g, h) + row*h, h);
+}
+
+static void EF_void_Menu_ClearDirty(void)
+{
+	U8_t index;
+
+	full_redraw = FALSE;
+	for(index = 0; index < MENU_DIRTY_AREAS; index++)
+	{
+		dirty_y0[index] = (u8g_uint_t)~(u8g_uint_t)0;
+		dirty_y1[index] = 0;
+	}
+}
+
+/* (re)start the menu timer, used for the spinner and the result time */
+static void EF_void_Menu_StartTimer(U32_t ticks)
+{
+	EF_void_Timer_TurnOff(MENU_TIMER_ID);
+	EF_void_TimerChangeTimeOut(MENU_TIMER_ID, ticks);
+	EF_void_TimerStart(MENU_TIMER_ID);
+}
+
+static void EF_void_Menu_DrawSpinner(u8g_t *u8g)
+{
+	U8_t index, x, y;
+
+	for(index = 0; index < 8; index++)
+	{
+		x = MENU_SPINNER_X + pgm_read_byte(&spinner_dots[index][0]);
+		y = MENU_SPINNER_Y + pgm_read_byte(&spinner_dots[index][1]);
+		if(index == spinner_frame)
+		{
+			u8g_DrawBox(u8g, x, y, 2, 2);
+		}
+		else
+		{
+			u8g_DrawPixel(u8g, x, y);
+		}
+	}
+}
+
+/* picture loop body, u8g_RenderStep() calls it for every page of the render window.
+ * Only the visible items which intersect the current page are drawn. */
+static void EF_void_Menu_DrawPage(u8g_t *u8g)
+{
+	const MENU_node_str *node = MENU_NODE();
+	const MENU_item_str *items = (const MENU_item_str *)MENU_READ_PTR(&node->items);
+	U8_t numberOfItems = pgm_read_byte(&node->numberOfItems);
+	const u8g_pgm_uint8_t *label;
+	U8_t index, last, rows, h;
+	u8g_uint_t w, y, listTop, listHeight;
+
+	h = EF_u8_Menu_RowHeight(u8g);
+	if(screen_draw != NULL)
+	{
+		screen_draw(u8g);
+		if(spinner_on == TRUE)
+		{
+			EF_void_Menu_DrawSpinner(u8g);
+		}
+		return;
+	}
+
+	u8g_DrawStrP(u8g, MENU_TITLE_X, MENU_TITLE_Y, (const u8g_pgm_uint8_t *)MENU_READ_PTR(&node->title));
+
+	w = u8g_GetWidth(u8g);
+	listTop = EF_u8g_Menu_ListTop(u8g, h);
+	rows = (u8g_GetHeight(u8g) - listTop) / h;
+	if(rows == 0)
+	{
+		rows = 1;
+	}
+
+	if(numberOfItems > rows)
+	{
+		/* scroll bar: thin track with a thumb for the visible part */
+		w -= MENU_SCROLLBAR_WIDTH;
+		listHeight = rows*h;
+		u8g_DrawVLine(u8g, w + MENU_SCROLLBAR_WIDTH - 1, listTop, listHeight);
+		u8g_DrawBox(u8g, w + 1, listTop + (listHeight*menu_top)/numberOfItems,
+				MENU_SCROLLBAR_WIDTH - 1, (listHeight*rows)/numberOfItems);
+	}
+
+	if(u8g->current_page.y1 < listTop)
+	{
+		return;
+	}
+
+	/* first and last screen row in this page */
+	index = 0;
+	if(u8g->current_page.y0 > listTop)
+	{
+		index = (u8g->current_page.y0 - listTop) / h;
+	}
+	last = (u8g->current_page.y1 - listTop) / h;
+	if(last >= rows)
+	{
+		last = rows - 1;
+	}
+
+	for(; index <= last && menu_top + index < numberOfItems; index++)
+	{
+		label = (const u8g_pgm_uint8_t *)MENU_READ_PTR(&items[menu_top + index].label);
+		y = (index + MENU_FIRST_ITEM_ROW)*h;
+		if(menu_top + index == menu_current)
+		{
+			u8g_DrawStrInverseP(u8g, 0, y, w, label);
+		}
+		else
+		{
+			u8g_DrawStrP(u8g, 0, y, label);
+		}
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_Init
+*
+* DESCRIPTION : show the root menu with the first item selected.
+*
+* PARAMETERS  : u8g  : display used for drawing
+* 				root : root menu table in program memory
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_Init(u8g_t *u8g, const MENU_node_str *root)
+{
+	menu_u8g       = u8g;
+	menu_depth     = 0;
+	menu_stack[0]  = root;
+	menu_current   = 0;
+	menu_drawn     = 0;
+	menu_top       = 0;
+	menu_drawn_top = 0;
+	frame_pending  = FALSE;
+	display_valid  = FALSE;
+	screen_draw    = NULL;
+	screen_task    = NULL;
+	task_next      = NULL;
+	spinner_on     = FALSE;
+	EF_void_Menu_ClearDirty();
+	EF_void_TimerCreate(MENU_TIMER_ID, MENU_SPINNER_TICKS);
+	EF_void_Render_Invalidate(RENDER_EVENT_SCREEN);
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_Enter
+*
+* DESCRIPTION : open a sub menu, the current menu is kept for EF_void_Menu_Back().
+*
+* PARAMETERS  : node : menu table in program memory
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_Enter(const MENU_node_str *node)
+{
+	if(menu_depth < MENU_MAX_DEPTH - 1)
+	{
+		menu_depth++;
+	}
+	menu_stack[menu_depth] = node;
+	menu_current = 0;
+	menu_top     = 0;
+	screen_draw  = NULL;
+	EF_void_Render_Invalidate(RENDER_EVENT_SCREEN);
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_Back
+*
+* DESCRIPTION : return to the parent menu, nothing happens in the root menu.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_Back(void)
+{
+	if(menu_depth > 0)
+	{
+		menu_depth--;
+		menu_current = 0;
+		menu_top     = 0;
+		EF_void_Render_Invalidate(RENDER_EVENT_SCREEN);
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_HandleKey
+*
+* DESCRIPTION : move the selection with PREV/NEXT (press and repeat), SELECT
+* 				calls the item action and enters its sub menu, BACK returns
+* 				to the parent menu.
+*
+* PARAMETERS  : keyEvent : event from EF_BOOLEAN_Keys_GetEvent()
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_HandleKey(U8_t keyEvent)
+{
+	const MENU_node_str *node = MENU_NODE();
+	const MENU_item_str *item;
+	U8_t numberOfItems = pgm_read_byte(&node->numberOfItems);
+	MENU_action_t action;
+	const MENU_node_str *child;
+	U8_t type = KEY_EVENT_TYPE(keyEvent);
+
+	if(type != KEY_EVENT_PRESS && type != KEY_EVENT_REPEAT)
+	{
+		return;
+	}
+
+	if(EF_BOOLEAN_Menu_IsBusy() == TRUE)
+	{
+		/* busy, the flow continues by itself */
+		return;
+	}
+
+	if(screen_draw != NULL)
+	{
+		/* any key closes the screen */
+		if(type == KEY_EVENT_PRESS)
+		{
+			EF_void_Menu_CloseScreen();
+		}
+		return;
+	}
+
+	switch(KEY_EVENT_CODE(keyEvent))
+	{
+	case KEY_NEXT:
+		menu_current++;
+		if(menu_current >= numberOfItems)
+		{
+			menu_current = 0;
+		}
+		EF_void_Menu_ScrollToSelection();
+		EF_void_Render_Invalidate(RENDER_EVENT_MENU);
+		break;
+
+	case KEY_PREV:
+		if(menu_current == 0)
+		{
+			menu_current = numberOfItems;
+		}
+		menu_current--;
+		EF_void_Menu_ScrollToSelection();
+		EF_void_Render_Invalidate(RENDER_EVENT_MENU);
+		break;
+
+	case KEY_SELECT:
+		if(type != KEY_EVENT_PRESS)
+		{
+			break;
+		}
+		item   = (const MENU_item_str *)MENU_READ_PTR(&node->items) + menu_current;
+		action = (MENU_action_t)MENU_READ_PTR(&item->action);
+		child  = (const MENU_node_str *)MENU_READ_PTR(&item->child);
+		if(action != NULL)
+		{
+			/* the action may draw directly: drop the frame in progress,
+			 * the next frame must be complete */
+			frame_pending = FALSE;
+			display_valid = FALSE;
+			u8g_RenderRestart(menu_u8g);
+			action();
+		}
+		if(screen_task != NULL)
+		{
+			/* the action started a task, the sub menu follows when it is finished */
+			task_next = child;
+		}
+		else if(child != NULL)
+		{
+			EF_void_Menu_Enter(child);
+		}
+		break;
+
+	case KEY_BACK:
+		if(type == KEY_EVENT_PRESS)
+		{
+			EF_void_Menu_Back();
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_Render
+*
+* DESCRIPTION : called once per main loop iteration with the result of
+* 				EF_u8_Render_Poll(), writes at most one page per call.
+* 				A selection change redraws only the pages of the old and
+* 				the new highlighted rows: adjacent rows are written as one
+* 				window, rows far apart (wrap around) as two windows one
+* 				after the other, the rows between them are not written.
+*
+* PARAMETERS  : renderEvents : RENDER_EVENT_xxx, RENDER_EVENT_NONE if no new frame is due
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_Render(U8_t renderEvents)
+{
+
+	if(renderEvents != RENDER_EVENT_NONE)
+	{
+		/* start over, a half drawn frame would mix old and new state */
+		u8g_RenderRestart(menu_u8g);
+		frame_pending = TRUE;
+
+		if((renderEvents & RENDER_EVENT_SCREEN) || display_valid == FALSE)
+		{
+			full_redraw = TRUE;
+		}
+		else if(screen_draw != NULL)
+		{
+			if(renderEvents & ~RENDER_EVENT_ANIMATION)
+			{
+				full_redraw = TRUE;
+			}
+			else
+			{
+				EF_void_Menu_MarkArea(MENU_SPINNER_Y, MENU_SPINNER_SIZE);
+			}
+		}
+		else if(menu_top != menu_drawn_top)
+		{
+			/* scrolled: all item rows moved, the title stays */
+			U8_t h = EF_u8_Menu_RowHeight(menu_u8g);
+			EF_void_Menu_MarkArea(EF_u8g_Menu_ListTop(menu_u8g, h), EF_u8_Menu_VisibleRows()*h);
+		}
+		else
+		{
+			EF_void_Menu_MarkRow(menu_drawn - menu_top);
+			EF_void_Menu_MarkRow(menu_current - menu_top);
+		}
+
+		if(full_redraw == FALSE)
+		{
+			u8g_SetRenderWindow(menu_u8g, dirty_y0[0], dirty_y1[0] - dirty_y0[0] + 1);
+		}
+		else
+		{
+			u8g_SetRenderWindow(menu_u8g, 0, u8g_GetHeight(menu_u8g));
+		}
+	}
+
+	if(frame_pending == TRUE)
+	{
+		if(u8g_RenderStep(menu_u8g, EF_void_Menu_DrawPage) == 0)
+		{
+			if(full_redraw == FALSE && dirty_y0[1] <= dirty_y1[1])
+			{
+				/* first area written, continue with the second one */
+				dirty_y0[0] = dirty_y0[1];
+				dirty_y1[0] = dirty_y1[1];
+				dirty_y0[1] = (u8g_uint_t)~(u8g_uint_t)0;
+				dirty_y1[1] = 0;
+				u8g_SetRenderWindow(menu_u8g, dirty_y0[0], dirty_y1[0] - dirty_y0[0] + 1);
+				return;
+			}
+			frame_pending  = FALSE;
+			display_valid  = TRUE;
+			menu_drawn     = menu_current;
+			menu_drawn_top = menu_top;
+			EF_void_Menu_ClearDirty();
+		}
+	}
+}
+
+/****************************************************************************
+* Function    : EF_u8_Menu_GetSelection
+*
+* DESCRIPTION : index of the highlighted item of the current menu.
+*
+* PARAMETERS  : None.
+*
+* Return Value: item index.
+*
+******************************************************************************/
+U8_t EF_u8_Menu_GetSelection(void)
+{
+	return menu_current;
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_ShowScreen
+*
+* DESCRIPTION : show a screen instead of the menu. The screen is rendered page
+* 				by page like the menu, it is closed by any key or by
+* 				EF_void_Menu_CloseScreen().
+*
+* PARAMETERS  : drawFn : picture loop body of the screen
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_ShowScreen(u8g_draw_fn drawFn)
+{
+	screen_draw = drawFn;
+	EF_void_Render_Invalidate(RENDER_EVENT_SCREEN);
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_CloseScreen
+*
+* DESCRIPTION : stop the task of the screen and return to the menu.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_CloseScreen(void)
+{
+	screen_draw = NULL;
+	screen_task = NULL;
+	task_next   = NULL;
+	spinner_on  = FALSE;
+	EF_void_Timer_TurnOff(MENU_TIMER_ID);
+	EF_void_Render_Invalidate(RENDER_EVENT_SCREEN);
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_StartTask
+*
+* DESCRIPTION : run a long operation in the background of the shown screen.
+* 				EF_void_Menu_RunTask() calls the task once per main loop
+* 				until it returns TRUE, keys are ignored meanwhile. Then the
+* 				screen is drawn again to show the result. If the task was
+* 				started by an item action, the sub menu of the item is
+* 				entered MENU_RESULT_TICKS later.
+*
+* PARAMETERS  : task        : one step of the operation, must not block
+* 				showSpinner : TRUE to animate a spinner while the task runs
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_StartTask(MENU_task_t task, BOOLEAN showSpinner)
+{
+	screen_task   = task;
+	task_next     = NULL;
+	spinner_on    = showSpinner;
+	spinner_frame = 0;
+	if(showSpinner == TRUE)
+	{
+		EF_void_Menu_StartTimer(MENU_SPINNER_TICKS);
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_RunTask
+*
+* DESCRIPTION : called once per main loop iteration, runs one step of the
+* 				background task and moves the spinner.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_RunTask(void)
+{
+	const MENU_node_str *node;
+
+	if(screen_task != NULL)
+	{
+		if(spinner_on == TRUE && EF_BOOLEAN_TimerCheck(MENU_TIMER_ID))
+		{
+			spinner_frame = (spinner_frame + 1) & 7;
+			EF_void_Render_Invalidate(RENDER_EVENT_ANIMATION);
+		}
+
+		if(screen_task() == TRUE)
+		{
+			screen_task = NULL;
+			spinner_on  = FALSE;
+			EF_void_Timer_TurnOff(MENU_TIMER_ID);
+			if(screen_draw != NULL)
+			{
+				/* show the result */
+				EF_void_Render_Invalidate(RENDER_EVENT_SCREEN);
+			}
+			if(task_next != NULL)
+			{
+				EF_void_Menu_StartTimer(MENU_RESULT_TICKS);
+			}
+		}
+	}
+	else if(task_next != NULL && EF_BOOLEAN_TimerCheck(MENU_TIMER_ID))
+	{
+		EF_void_Timer_TurnOff(MENU_TIMER_ID);
+		node = task_next;
+		task_next = NULL;
+		EF_void_Menu_Enter(node);
+	}
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Menu_IsRendering
+*
+* DESCRIPTION : check for a frame which is not completely written.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE while EF_void_Menu_Render() has pages to write.
+*
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_Menu_IsRendering(void)
+{
+	return frame_pending;
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Menu_IsBusy
+*
+* DESCRIPTION : check for a running background task or a pending change to
+* 				the menu after it.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE while busy, keys are ignored then.
+*
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_Menu_IsBusy(void)
+{
+	return (screen_task != NULL || task_next != NULL);
+}
+
+/****************************************************************************
+* Function    : EF_void_Menu_CancelNext
+*
+* DESCRIPTION : called by a background task that failed, the menu of the
+* 				selected item is not entered. The screen stays until a key
+* 				is pressed.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Menu_CancelNext(void)
+{
+	task_next = NULL;
+}
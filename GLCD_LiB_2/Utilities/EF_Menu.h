@@ -0,0 +1,242 @@
+/***************************************************************
+ *  Source File: EF_Menu.h
+ *
+ *  Description: table driven menu engine, menu tables in program memory and partial redraw
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+#ifndef _MENU_ENGINE_H__
+#define _MENU_ENGINE_H__
+
+#include <avr/pgmspace.h>
+#include "../u8g.h"
+#include "../HAL/EF_Keys.h"
+#include "EF_Render.h"
+#include "EF_Menu_cfg.h"
+
+/**************************************************
+ * Types
+ **************************************************/
+/* called when the item is selected, may draw its own screen */
+typedef void (*MENU_action_t)(void);
+
+/* one step of a long operation, returns TRUE when it is finished */
+typedef BOOLEAN (*MENU_task_t)(void);
+
+typedef struct MENU_node_str MENU_node_str;
+
+/* all menu tables are placed in program memory (PROGMEM),
+ * labels and titles are program memory strings (PSTR or PROGMEM arrays) */
+typedef struct
+{
+	const char *label;
+	MENU_action_t action;			/* NULL: no action       */
+	const MENU_node_str *child;		/* NULL: no sub menu, else entered after the action */
+}MENU_item_str;
+
+struct MENU_node_str
+{
+	const char *title;
+	const MENU_item_str *items;
+	U8_t numberOfItems;
+};
+
+
+/*************************************************
+ * 	 API functions
+ *************************************************/
+
+/****************************************************************************
+* Function    : EF_void_Menu_Init
+*
+* DESCRIPTION : show the root menu with the first item selected.
+*
+* PARAMETERS  : u8g  : display used for drawing
+* 				root : root menu table in program memory
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_Init(u8g_t *u8g, const MENU_node_str *root);
+
+/****************************************************************************
+* Function    : EF_void_Menu_Enter
+*
+* DESCRIPTION : open a sub menu, the current menu is kept for EF_void_Menu_Back().
+*
+* PARAMETERS  : node : menu table in program memory
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_Enter(const MENU_node_str *node);
+
+/****************************************************************************
+* Function    : EF_void_Menu_Back
+*
+* DESCRIPTION : return to the parent menu, nothing happens in the root menu.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_Back(void);
+
+/****************************************************************************
+* Function    : EF_void_Menu_HandleKey
+*
+* DESCRIPTION : move the selection with PREV/NEXT (press and repeat), SELECT
+* 				calls the item action and enters its sub menu, BACK returns
+* 				to the parent menu.
+*
+* PARAMETERS  : keyEvent : event from EF_BOOLEAN_Keys_GetEvent()
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_HandleKey(U8_t keyEvent);
+
+/****************************************************************************
+* Function    : EF_void_Menu_Render
+*
+* DESCRIPTION : called once per main loop iteration with the result of
+* 				EF_u8_Render_Poll(), writes at most one page per call.
+* 				A selection change redraws only the pages of the old and
+* 				the new highlighted rows.
+*
+* PARAMETERS  : renderEvents : RENDER_EVENT_xxx, RENDER_EVENT_NONE if no new frame is due
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_Render(U8_t renderEvents);
+
+/****************************************************************************
+* Function    : EF_void_Menu_ShowScreen
+*
+* DESCRIPTION : show a screen instead of the menu. The screen is rendered page
+* 				by page like the menu, it is closed by any key or by
+* 				EF_void_Menu_CloseScreen().
+*
+* PARAMETERS  : drawFn : picture loop body of the screen
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_ShowScreen(u8g_draw_fn drawFn);
+
+/****************************************************************************
+* Function    : EF_void_Menu_CloseScreen
+*
+* DESCRIPTION : stop the task of the screen and return to the menu.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_CloseScreen(void);
+
+/****************************************************************************
+* Function    : EF_void_Menu_StartTask
+*
+* DESCRIPTION : run a long operation in the background of the shown screen.
+* 				EF_void_Menu_RunTask() calls the task once per main loop
+* 				until it returns TRUE, keys are ignored meanwhile. Then the
+* 				screen is drawn again to show the result. If the task was
+* 				started by an item action, the sub menu of the item is
+* 				entered MENU_RESULT_TICKS later.
+*
+* PARAMETERS  : task        : one step of the operation, must not block
+* 				showSpinner : TRUE to animate a spinner while the task runs
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_StartTask(MENU_task_t task, BOOLEAN showSpinner);
+
+/****************************************************************************
+* Function    : EF_void_Menu_RunTask
+*
+* DESCRIPTION : called once per main loop iteration, runs one step of the
+* 				background task and moves the spinner.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_RunTask(void);
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Menu_IsRendering
+*
+* DESCRIPTION : check for a frame which is not completely written.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE while EF_void_Menu_Render() has pages to write.
+*
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_Menu_IsRendering(void);
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Menu_IsBusy
+*
+* DESCRIPTION : check for a running background task or a pending change to
+* 				the menu after it.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE while busy, keys are ignored then.
+*
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_Menu_IsBusy(void);
+
+/****************************************************************************
+* Function    : EF_void_Menu_CancelNext
+*
+* DESCRIPTION : called by a background task that failed, the menu of the
+* 				selected item is not entered. The screen stays until a key
+* 				is pressed.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Menu_CancelNext(void);
+
+/****************************************************************************
+* Function    : EF_u8_Menu_GetSelection
+*
+* DESCRIPTION : index of the highlighted item of the current menu.
+*
+* PARAMETERS  : None.
+*
+* Return Value: item index.
+*
+******************************************************************************/
+extern U8_t EF_u8_Menu_GetSelection(void);
+
+#endif
@@ -0,0 +1,60 @@
+/***************************************************************
+ *  Source File: EF_Menu_cfg.h
+ *
+ *  Description: table driven menu engine, menu tables in program memory and partial redraw
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#ifndef MENU_CFG_H_
+#define MENU_CFG_H_
+
+#include "std_types.h"
+#include "EF_SpechialTIMER.h"
+
+/**************************************************
+ * Definitions
+ **************************************************/
+/* maximum number of nested menus (root menu included) */
+#define MENU_MAX_DEPTH				4
+
+/* position of the menu title in pixel */
+#define MENU_TITLE_X				15
+#define MENU_TITLE_Y				3
+
+/* the first item is drawn in this text row, row height is the font height */
+#define MENU_FIRST_ITEM_ROW			2
+
+/* width of the scroll bar, shown if not all items fit on the display */
+#define MENU_SCROLLBAR_WIDTH		3
+
+/* busy spinner of screens with a background task, 8x8 pixel in the top right
+ * corner so that one animation step writes only one page */
+#define MENU_SPINNER_X				119
+#define MENU_SPINNER_Y				0
+#define MENU_SPINNER_SIZE			8
+#define MENU_SPINNER_TICKS			(100/SYSTEMTICKTIME)
+
+/* time the result of a task is shown before the sub menu is entered */
+#define MENU_RESULT_TICKS			(1000/SYSTEMTICKTIME)
+
+#endif
@@ -0,0 +1,227 @@
+/***************************************************************
+ *  Source File: EF_Mirror.c
+ *
+ *  Description: copy of the display pages to the host over UART
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include "EF_Mirror.h"
+#include "EF_Frame.h"
+
+/* every packed byte may be escaped, the largest chunk frame must fit in the
+ * free part of the transmit buffer (one place is always kept free) */
+#if (2 * MIRROR_PACKED_BYTES + MIRROR_FRAME_OVERHEAD) > (UART_TX_BUFFER_SIZE - 1)
+#error "MIRROR_CHUNK_LINES is too large for UART_TX_BUFFER_SIZE"
+#endif
+
+/**************************************************
+ * 	global variables
+ *************************************************/
+/* CRC of each page when it was sent, only the pages in mirror_sent are valid */
+static U16_t mirror_crc[MIRROR_MAX_PAGES];
+static U8_t  mirror_sent;
+
+/* statistics of the picture which is rendered */
+static U16_t mirror_frameBytes;
+static U8_t  mirror_skippedPages;
+
+static U8_t  mirror_packed[MIRROR_PACKED_BYTES];
+
+/**************************************************
+ * 	local functions
+ *************************************************/
+static U16_t EF_u16_Mirror_Crc(const U8_t *data, U8_t length)
+{
+	U16_t crc = FRAME_CRC_INIT;
+	U8_t bit;
+
+	while(length-- > 0)
+	{
+		crc ^= (U16_t)*data++ << 8;
+		for(bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x8000) ? (crc << 1) ^ FRAME_CRC_POLYNOMIAL : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+/* PackBits: n = 0..127: n+1 literal bytes follow, n = 129..255: the next byte 257-n times */
+static U8_t EF_u8_Mirror_Pack(const U8_t *src, U8_t length, U8_t *dst)
+{
+	U8_t in = 0, out = 0;
+	U8_t run, literal;
+
+	while(in < length)
+	{
+		for(run = 1; in + run < length && run < 128 && src[in + run] == src[in]; run++);
+
+		if(run >= MIRROR_MIN_RUN)
+		{
+			dst[out++] = (U8_t)(257 - run);
+			dst[out++] = src[in];
+			in += run;
+		}
+		else
+		{
+			/* literal bytes until the next run */
+			literal = out++;
+			run = 0;
+			do
+			{
+				dst[out++] = src[in++];
+				run++;
+			}
+			while(in < length && run < 128 &&
+					!(in + 2 < length && src[in] == src[in + 1] && src[in] == src[in + 2]));
+			dst[literal] = run - 1;
+		}
+	}
+	return out;
+}
+
+/* bytes of the SLIP encoded data, END and ESC are sent as 2 bytes */
+static U16_t EF_u16_Mirror_Escaped(const U8_t *data, U8_t length)
+{
+	U16_t size = length;
+
+	while(length-- > 0)
+	{
+		if(*data == FRAME_SLIP_END || *data == FRAME_SLIP_ESC)
+		{
+			size++;
+		}
+		data++;
+	}
+	return size;
+}
+
+/* send the lines y .. y+lines-1 of the page buffer, FALSE if the frame doesn't fit */
+static BOOLEAN EF_BOOLEAN_Mirror_SendLines(u8g_pb_t *pb, U8_t y, U8_t lines)
+{
+	U8_t lineBytes = (U8_t)(pb->width / 8);
+	U8_t packedLength;
+	U8_t index;
+
+	packedLength = EF_u8_Mirror_Pack((const U8_t *)pb->buf + y*lineBytes, lines*lineBytes, mirror_packed);
+	if(EF_u16_Mirror_Escaped(mirror_packed, packedLength) + MIRROR_FRAME_OVERHEAD > EF_u8_UART_GetTxFree())
+	{
+		return FALSE;
+	}
+
+	EF_void_Frame_Begin(FRAME_TYPE_PAGE);
+	EF_void_Frame_PutVarint(pb->p.page_y0 + y);
+	EF_void_Frame_PutVarint(lines);
+	EF_void_Frame_PutVarint(pb->width);
+	for(index = 0; index < packedLength; index++)
+	{
+		EF_void_Frame_PutByte(mirror_packed[index]);
+	}
+	EF_void_Frame_End();
+	mirror_frameBytes += EF_u16_Frame_GetLength();
+	return TRUE;
+}
+
+/* hook of the display device, called before the page is flushed */
+static void EF_void_Mirror_Page(u8g_t *u8g, u8g_pb_t *pb)
+{
+	U8_t  length = (U8_t)((pb->width / 8) * pb->p.page_height);
+	U8_t  page   = pb->p.page;
+	U8_t  mask   = 1 << page;
+	U8_t  y, lines;
+	U16_t crc;
+
+	if(page < MIRROR_MAX_PAGES && length <= MIRROR_PAGE_BYTES && pb->width / 8 <= MIRROR_LINE_BYTES)
+	{
+		crc = EF_u16_Mirror_Crc((const U8_t *)pb->buf, length);
+		if((mirror_sent & mask) == 0 || mirror_crc[page] != crc)
+		{
+			/* a whole page may not fit in the transmit buffer at all,
+			 * it is sent in chunks of MIRROR_CHUNK_LINES lines */
+			for(y = 0; y < pb->p.page_height; y += lines)
+			{
+				lines = pb->p.page_height - y;
+				if(lines > MIRROR_CHUNK_LINES)
+				{
+					lines = MIRROR_CHUNK_LINES;
+				}
+				if(EF_BOOLEAN_Mirror_SendLines(pb, y, lines) == FALSE)
+				{
+					break;
+				}
+			}
+
+			if(y >= pb->p.page_height)
+			{
+				mirror_crc[page] = crc;
+				mirror_sent     |= mask;
+			}
+			else
+			{
+				/* the whole page is sent when it is flushed the next time */
+				mirror_skippedPages++;
+				mirror_sent &= ~mask;
+			}
+		}
+	}
+
+	/* last page of the picture, u8g_RenderStep() skips the pages after render_y1 */
+	if(pb->p.page_y1 >= u8g->render_y1 || pb->p.page_y1 + 1 >= pb->p.total_height)
+	{
+		if(mirror_frameBytes != 0 || mirror_skippedPages != 0)
+		{
+			EF_void_Frame_Begin(FRAME_TYPE_FRAME_END);
+			EF_void_Frame_PutVarint(mirror_frameBytes);
+			EF_void_Frame_PutVarint(mirror_skippedPages);
+			EF_void_Frame_End();
+		}
+		mirror_frameBytes   = 0;
+		mirror_skippedPages = 0;
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Mirror_Enable
+*
+* DESCRIPTION : switch the mirror on or off. While on, each page which the
+* 				display device flushes is sent as FRAME_TYPE_PAGE if it
+* 				changed since it was sent the last time, and each picture ends
+* 				with FRAME_TYPE_FRAME_END. A page is sent as frames of
+* 				MIRROR_CHUNK_LINES lines, which are only sent if they fit in
+* 				the UART transmit buffer, the rendering never waits.
+*
+* PARAMETERS  : u8g    : the display
+* 				enable : TRUE: on, FALSE: off
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Mirror_Enable(u8g_t *u8g, BOOLEAN enable)
+{
+	/* the host may have missed pages, send all of them again */
+	mirror_sent         = 0;
+	mirror_frameBytes   = 0;
+	mirror_skippedPages = 0;
+
+	u8g_SetPageHook(u8g, (enable == TRUE) ? EF_void_Mirror_Page : NULL);
+}
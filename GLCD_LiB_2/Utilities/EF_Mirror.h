@@ -0,0 +1,55 @@
+/***************************************************************
+ *  Source File: EF_Mirror.h
+ *
+ *  Description: copy of the display pages to the host over UART
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+#ifndef _MIRROR_H__
+#define _MIRROR_H__
+
+#include "EF_Mirror_cfg.h"
+#include "../u8g.h"
+
+/*************************************************
+ * 	 API functions
+ *************************************************/
+
+/****************************************************************************
+* Function    : EF_void_Mirror_Enable
+*
+* DESCRIPTION : switch the mirror on or off. While on, each page which the
+* 				display device flushes is sent as FRAME_TYPE_PAGE if it
+* 				changed since it was sent the last time, and each picture ends
+* 				with FRAME_TYPE_FRAME_END. A page is sent as frames of
+* 				MIRROR_CHUNK_LINES lines, which are only sent if they fit in
+* 				the UART transmit buffer, the rendering never waits.
+*
+* PARAMETERS  : u8g    : the display
+* 				enable : TRUE: on, FALSE: off
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Mirror_Enable(u8g_t *u8g, BOOLEAN enable);
+
+#endif
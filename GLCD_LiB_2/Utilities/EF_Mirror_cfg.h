@@ -0,0 +1,59 @@
+/***************************************************************
+ *  Source File: EF_Mirror_cfg.h
+ *
+ *  Description: copy of the display pages to the host over UART
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#ifndef MIRROR_CFG_H_
+#define MIRROR_CFG_H_
+
+#include "std_types.h"
+
+/**************************************************
+ * Definitions
+ **************************************************/
+/* the mirror is switched on by menu.c at start up */
+#define MIRROR_AT_STARTUP			FALSE
+
+/* pages of one picture and bytes of one page buffer (128x64, 8 lines per page) */
+#define MIRROR_MAX_PAGES			8		/* max. 8 */
+#define MIRROR_PAGE_BYTES			128
+#define MIRROR_LINE_BYTES			16		/* max. display width / 8 */
+
+/* a page is sent as frames of this many lines, each frame must fit in the
+ * UART transmit buffer even if nothing can be compressed, see EF_Mirror.c */
+#define MIRROR_CHUNK_LINES			2
+#define MIRROR_CHUNK_BYTES			(MIRROR_CHUNK_LINES * MIRROR_LINE_BYTES)
+
+/* PackBits: a chunk of the same byte is 2 bytes, a chunk without runs 1 byte more */
+#define MIRROR_PACKED_BYTES			(MIRROR_CHUNK_BYTES + (MIRROR_CHUNK_BYTES + 127)/128)
+
+/* frame bytes besides the packed data: 2 END, type, 3 varints of 1..2 bytes,
+ * 2 crc bytes, which may be escaped */
+#define MIRROR_FRAME_OVERHEAD		16
+
+/* runs shorter than this are sent as literal bytes */
+#define MIRROR_MIN_RUN				3
+
+#endif
@@ -0,0 +1,144 @@
+/***************************************************************
+ *  Source File: EF_Render.c
+ *
+ *  Description: render scheduler, coalesce redraw requests and limit the frame rate
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include <avr/interrupt.h>
+#include "EF_Render.h"
+
+/**************************************************
+ * 	global variables
+ *************************************************/
+static volatile U8_t pending_events;		/* events posted since the last frame  */
+static volatile BOOLEAN frame_slot_free;	/* frame interval is over, render allowed */
+static void (*readyHookPtr)(void) = NULL;	/* a render is due */
+
+/* one shot callback of the frame timer, runs in the Timer ISR */
+static void EF_void_Render_FrameElapsed(U8_t timerNumber)
+{
+	frame_slot_free = TRUE;
+	if(pending_events != RENDER_EVENT_NONE && readyHookPtr != NULL)
+	{
+		readyHookPtr();
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Render_Init
+*
+* DESCRIPTION : create the frame timer, no event is pending.
+* 				EF_void_TimerInit() must be called before.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Render_Init(void)
+{
+	pending_events  = RENDER_EVENT_NONE;
+	frame_slot_free = TRUE;
+	EF_void_TimerCreate(RENDER_TIMER_ID, RENDER_FRAME_TICKS);
+	EF_void_TimerSetCallback(RENDER_TIMER_ID, EF_void_Render_FrameElapsed, TIMER_MODE_ONE_SHOT);
+}
+
+/****************************************************************************
+* Function    : EF_void_Render_Invalidate
+*
+* DESCRIPTION : post invalidation events, all events posted before the next
+* 				frame is due are coalesced into one render.
+* 				can be called from the main loop and from ISRs.
+*
+* PARAMETERS  : events : one or more RENDER_EVENT_xxx
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Render_Invalidate(U8_t events)
+{
+	U8_t sreg = SREG;
+	cli();
+	pending_events |= events;
+	if(frame_slot_free == TRUE && readyHookPtr != NULL)
+	{
+		readyHookPtr();
+	}
+	SREG = sreg;
+}
+
+/****************************************************************************
+* Function    : EF_void_Render_SetReadyHook
+*
+* DESCRIPTION : attach a function which is called when EF_u8_Render_Poll()
+* 				would return events: an event is posted while the frame
+* 				interval is over, or the frame interval ends while events
+* 				are pending. It may run in the Timer ISR, must be short.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Render_SetReadyHook(void (*hook)(void))
+{
+	U8_t sreg = SREG;
+
+	cli();
+	readyHookPtr = hook;
+	SREG = sreg;
+}
+
+/****************************************************************************
+* Function    : EF_u8_Render_Poll
+*
+* DESCRIPTION : called once per main loop iteration. If events are pending and
+* 				at least RENDER_FRAME_TIME passed since the last frame, the
+* 				pending events are returned and cleared, the caller must render.
+*
+* PARAMETERS  : None.
+*
+* Return Value: RENDER_EVENT_NONE or the coalesced events of this frame.
+*
+******************************************************************************/
+U8_t EF_u8_Render_Poll(void)
+{
+	U8_t events = RENDER_EVENT_NONE;
+	U8_t sreg;
+
+	if ((frame_slot_free == TRUE) && (pending_events != RENDER_EVENT_NONE))
+	{
+		sreg = SREG;
+		cli();
+		events = pending_events;
+		pending_events = RENDER_EVENT_NONE;
+		SREG = sreg;
+
+		/* next frame not before one full frame interval */
+		frame_slot_free = FALSE;
+		EF_void_TimerReset(RENDER_TIMER_ID);
+		EF_void_TimerStart(RENDER_TIMER_ID);
+	}
+	return events;
+}
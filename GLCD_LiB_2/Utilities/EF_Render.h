@@ -0,0 +1,93 @@
+/***************************************************************
+ *  Source File: EF_Render.h
+ *
+ *  Description: render scheduler, coalesce redraw requests and limit the frame rate
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+#ifndef _RENDER_H__
+#define _RENDER_H__
+
+#include "EF_Render_cfg.h"
+
+
+/*************************************************
+ * 	 API functions
+ *************************************************/
+
+/****************************************************************************
+* Function    : EF_void_Render_Init
+*
+* DESCRIPTION : create the frame timer, no event is pending.
+* 				EF_void_TimerInit() must be called before.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Render_Init(void);
+
+/****************************************************************************
+* Function    : EF_void_Render_Invalidate
+*
+* DESCRIPTION : post invalidation events, all events posted before the next
+* 				frame is due are coalesced into one render.
+* 				can be called from the main loop and from ISRs.
+*
+* PARAMETERS  : events : one or more RENDER_EVENT_xxx
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Render_Invalidate(U8_t events);
+
+/****************************************************************************
+* Function    : EF_u8_Render_Poll
+*
+* DESCRIPTION : called once per main loop iteration. If events are pending and
+* 				at least RENDER_FRAME_TIME passed since the last frame, the
+* 				pending events are returned and cleared, the caller must render.
+*
+* PARAMETERS  : None.
+*
+* Return Value: RENDER_EVENT_NONE or the coalesced events of this frame.
+*
+******************************************************************************/
+extern U8_t EF_u8_Render_Poll(void);
+
+/****************************************************************************
+* Function    : EF_void_Render_SetReadyHook
+*
+* DESCRIPTION : attach a function which is called when EF_u8_Render_Poll()
+* 				would return events: an event is posted while the frame
+* 				interval is over, or the frame interval ends while events
+* 				are pending. It may run in the Timer ISR, must be short.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Render_SetReadyHook(void (*hook)(void));
+
+#endif
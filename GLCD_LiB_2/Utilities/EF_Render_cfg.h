@@ -0,0 +1,47 @@
+/***************************************************************
+ *  Source File: EF_Render_cfg.h
+ *
+ *  Description: render scheduler, coalesce redraw requests and limit the frame rate
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#ifndef RENDER_CFG_H_
+#define RENDER_CFG_H_
+
+#include "std_types.h"
+#include "EF_SpechialTIMER.h"
+
+/**************************************************
+ * Definitions
+ **************************************************/
+/* minimum time between two rendered frames in ms (100 ms = max. 10 frames per second) */
+#define RENDER_FRAME_TIME			100
+#define RENDER_FRAME_TICKS			(RENDER_FRAME_TIME/SYSTEMTICKTIME)
+
+/* invalidation events, the application can define more up to bit 7 */
+#define RENDER_EVENT_NONE			0x00
+#define RENDER_EVENT_MENU			0x01	/* menu selection changed      */
+#define RENDER_EVENT_SCREEN			0x02	/* other screen became active  */
+#define RENDER_EVENT_ANIMATION		0x04	/* next step of an animation   */
+
+#endif
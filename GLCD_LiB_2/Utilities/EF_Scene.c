@@ -0,0 +1,228 @@
+/***************************************************************
+ *  Source File: EF_Scene.c
+ *
+ *  Description: screens pushed by the host as draw commands
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include <string.h>
+#include "EF_Scene.h"
+
+/**************************************************
+ * 	global variables
+ *************************************************/
+/* display lists: command | length | data[length] ...
+ * the shown one is replayed, the other one receives the next scene */
+static U8_t scene_list[2][SCENE_LIST_BYTES];
+static U8_t scene_length[2];
+static U8_t scene_shown;
+
+static BOOLEAN scene_receiving;		/* between CMD_SCENE_BEGIN and CMD_SCENE_END */
+static BOOLEAN scene_overflow;		/* the received scene did not fit            */
+static BOOLEAN scene_changed;
+
+static const u8g_fntpgm_uint8_t * const *scene_fonts;
+static U8_t scene_numberOfFonts;
+static const SCENE_bitmap_str *scene_bitmaps;
+static U8_t scene_numberOfBitmaps;
+
+/**************************************************
+ * 	local functions
+ *************************************************/
+/* minimum data length of a draw command, 0xFF: no draw command */
+static U8_t EF_u8_Scene_DataLength(U8_t command)
+{
+	switch(command)
+	{
+	case CMD_SET_FONT:	return 1;
+	case CMD_DRAW_STR:	return 2;
+	case CMD_DRAW_BOX:	return 4;
+	case CMD_DRAW_XBMP:	return 3;
+	default:			return 0xFF;
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Scene_Init
+*
+* DESCRIPTION : the display list is empty. The host selects fonts and bitmaps
+* 				by their index in these arrays.
+*
+* PARAMETERS  : fonts           : fonts of CMD_SET_FONT
+* 				numberOfFonts   : entries of fonts
+* 				bitmaps         : bitmaps of CMD_DRAW_XBMP
+* 				numberOfBitmaps : entries of bitmaps
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Scene_Init(const u8g_fntpgm_uint8_t * const *fonts, U8_t numberOfFonts,
+		const SCENE_bitmap_str *bitmaps, U8_t numberOfBitmaps)
+{
+	scene_fonts           = fonts;
+	scene_numberOfFonts   = numberOfFonts;
+	scene_bitmaps         = bitmaps;
+	scene_numberOfBitmaps = numberOfBitmaps;
+
+	scene_length[0] = 0;
+	scene_length[1] = 0;
+	scene_shown     = 0;
+	scene_receiving = FALSE;
+	scene_changed   = FALSE;
+}
+
+/****************************************************************************
+* Function    : EF_void_Scene_Command
+*
+* DESCRIPTION : store one command of the host, has the type of
+* 				TRANSACTION_command_t. Commands between CMD_SCENE_BEGIN and
+* 				CMD_SCENE_END are collected, at CMD_SCENE_END they replace the
+* 				shown scene if they are different. Other commands are ignored.
+*
+* PARAMETERS  : command : CMD_xxx
+* 				data    : command data
+* 				length  : number of data bytes
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Scene_Command(U8_t command, const U8_t *data, U8_t length)
+{
+	U8_t back = scene_shown ^ 1;
+	U8_t *list = scene_list[back];
+	U8_t minLength;
+
+	if(command == CMD_SCENE_BEGIN)
+	{
+		scene_length[back] = 0;
+		scene_receiving    = TRUE;
+		scene_overflow     = FALSE;
+	}
+	else if(command == CMD_SCENE_END)
+	{
+		if(scene_receiving == TRUE && scene_overflow == FALSE &&
+				(scene_length[back] != scene_length[scene_shown] ||
+				 memcmp(list, scene_list[scene_shown], scene_length[back]) != 0))
+		{
+			scene_shown   = back;
+			scene_changed = TRUE;
+		}
+		scene_receiving = FALSE;
+	}
+	else if(scene_receiving == TRUE)
+	{
+		minLength = EF_u8_Scene_DataLength(command);
+		if(minLength == 0xFF || length < minLength)
+		{
+			return;
+		}
+		if(scene_length[back] + 2 + length > SCENE_LIST_BYTES)
+		{
+			scene_overflow = TRUE;
+			return;
+		}
+		list += scene_length[back];
+		list[0] = command;
+		list[1] = length;
+		memcpy(list + 2, data, length);
+		scene_length[back] += 2 + length;
+	}
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Scene_Changed
+*
+* DESCRIPTION : check for a new scene since the last call.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE once per new scene, the caller must redraw it.
+*
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_Scene_Changed(void)
+{
+	BOOLEAN changed = scene_changed;
+
+	scene_changed = FALSE;
+	return changed;
+}
+
+/****************************************************************************
+* Function    : EF_void_Scene_Draw
+*
+* DESCRIPTION : replay the display list, has the type of u8g_draw_fn and is
+* 				called in the picture loop. The font of u8g is restored.
+*
+* PARAMETERS  : u8g : the display
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Scene_Draw(u8g_t *u8g)
+{
+	const u8g_fntpgm_uint8_t *font = u8g->font;
+	const U8_t *list = scene_list[scene_shown];
+	const U8_t *end  = list + scene_length[scene_shown];
+	const SCENE_bitmap_str *bitmap;
+	char text[TRANSACTION_MAX_DATA - 1];	/* data of CMD_DRAW_STR without x, y */
+	U8_t length;
+
+	while(list < end)
+	{
+		length = list[1];
+		switch(list[0])
+		{
+		case CMD_SET_FONT:
+			if(list[2] < scene_numberOfFonts)
+			{
+				u8g_SetFont(u8g, scene_fonts[list[2]]);
+			}
+			break;
+		case CMD_DRAW_STR:
+			length -= 2;
+			if(length >= sizeof(text))
+			{
+				length = sizeof(text) - 1;
+			}
+			memcpy(text, list + 4, length);
+			text[length] = '\0';
+			u8g_DrawStr(u8g, list[2], list[3], text);
+			break;
+		case CMD_DRAW_BOX:
+			u8g_DrawBox(u8g, list[2], list[3], list[4], list[5]);
+			break;
+		case CMD_DRAW_XBMP:
+			if(list[4] < scene_numberOfBitmaps)
+			{
+				bitmap = &scene_bitmaps[list[4]];
+				u8g_DrawXBMP(u8g, list[2], list[3], bitmap->width, bitmap->height, bitmap->bits);
+			}
+			break;
+		default:
+			break;
+		}
+		list += 2 + list[1];
+	}
+
+	u8g_SetFont(u8g, font);
+}
@@ -0,0 +1,108 @@
+/***************************************************************
+ *  Source File: EF_Scene.h
+ *
+ *  Description: screens pushed by the host as draw commands
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+#ifndef _SCENE_H__
+#define _SCENE_H__
+
+#include "EF_Scene_cfg.h"
+#include "../u8g.h"
+
+/**************************************************
+ * Types
+ **************************************************/
+/* bitmap of CMD_DRAW_XBMP, the bits are in program memory */
+typedef struct
+{
+	U8_t width;
+	U8_t height;
+	const u8g_pgm_uint8_t *bits;
+}SCENE_bitmap_str;
+
+
+/*************************************************
+ * 	 API functions
+ *************************************************/
+
+/****************************************************************************
+* Function    : EF_void_Scene_Init
+*
+* DESCRIPTION : the display list is empty. The host selects fonts and bitmaps
+* 				by their index in these arrays.
+*
+* PARAMETERS  : fonts           : fonts of CMD_SET_FONT
+* 				numberOfFonts   : entries of fonts
+* 				bitmaps         : bitmaps of CMD_DRAW_XBMP
+* 				numberOfBitmaps : entries of bitmaps
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Scene_Init(const u8g_fntpgm_uint8_t * const *fonts, U8_t numberOfFonts,
+		const SCENE_bitmap_str *bitmaps, U8_t numberOfBitmaps);
+
+/****************************************************************************
+* Function    : EF_void_Scene_Command
+*
+* DESCRIPTION : store one command of the host, has the type of
+* 				TRANSACTION_command_t. Commands between CMD_SCENE_BEGIN and
+* 				CMD_SCENE_END are collected, at CMD_SCENE_END they replace the
+* 				shown scene if they are different. Other commands are ignored.
+*
+* PARAMETERS  : command : CMD_xxx
+* 				data    : command data
+* 				length  : number of data bytes
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Scene_Command(U8_t command, const U8_t *data, U8_t length);
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Scene_Changed
+*
+* DESCRIPTION : check for a new scene since the last call.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE once per new scene, the caller must redraw it.
+*
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_Scene_Changed(void);
+
+/****************************************************************************
+* Function    : EF_void_Scene_Draw
+*
+* DESCRIPTION : replay the display list, has the type of u8g_draw_fn and is
+* 				called in the picture loop. The font of u8g is restored.
+*
+* PARAMETERS  : u8g : the display
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Scene_Draw(u8g_t *u8g);
+
+#endif
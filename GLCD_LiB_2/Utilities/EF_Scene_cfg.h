@@ -0,0 +1,48 @@
+/***************************************************************
+ *  Source File: EF_Scene_cfg.h
+ *
+ *  Description: screens pushed by the host as draw commands
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#ifndef SCENE_CFG_H_
+#define SCENE_CFG_H_
+
+#include "std_types.h"
+#include "EF_Transaction_cfg.h"
+
+/**************************************************
+ * Definitions
+ **************************************************/
+/* commands of the host, one EF_Transaction frame each, x, y, w, h are pixel */
+#define CMD_SCENE_BEGIN			0x10	/* data: none, starts a new scene             */
+#define CMD_SCENE_END			0x11	/* data: none, shows the scene if it changed  */
+#define CMD_SET_FONT			0x12	/* data: font index                           */
+#define CMD_DRAW_STR			0x13	/* data: x, y, characters (no terminating 0)  */
+#define CMD_DRAW_BOX			0x14	/* data: x, y, w, h                           */
+#define CMD_DRAW_XBMP			0x15	/* data: x, y, bitmap index                   */
+
+/* bytes of the display list, each command takes 2 bytes + its data */
+#define SCENE_LIST_BYTES		96
+
+#endif
@@ -0,0 +1,206 @@
+/***************************************************************
+ *  Source File: EF_Scheduler.c
+ *
+ *  Description: cooperative run to completion scheduler for the main loop
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "EF_Scheduler.h"
+
+/**************************************************
+ * 	global variables
+ *************************************************/
+static SCHEDULER_task_t tasks_list[SCHEDULER_MAX_TASKS];
+static volatile U8_t    ready_tasks;					/* bit n: task n is ready        */
+static U8_t             timer_wake[MAX_NUMBER_OF_TIMERS];	/* tasks woken by each timer */
+
+/* callback of the timers used by EF_void_Scheduler_WakeOnTimer(), runs in the Timer ISR */
+static void EF_void_Scheduler_TimerElapsed(U8_t timerNumber)
+{
+	ready_tasks |= timer_wake[timerNumber];
+}
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_Init
+*
+* DESCRIPTION : remove all tasks, nothing is ready.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Scheduler_Init(void)
+{
+	U8_t index;
+
+	ready_tasks = 0;
+	for(index = 0; index < SCHEDULER_MAX_TASKS; index++)
+	{
+		tasks_list[index] = NULL;
+	}
+	for(index = 0; index < MAX_NUMBER_OF_TIMERS; index++)
+	{
+		timer_wake[index] = 0;
+	}
+	set_sleep_mode(SCHEDULER_SLEEP_MODE);
+}
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_AddTask
+*
+* DESCRIPTION : add a task, it is ready to run once.
+*
+* PARAMETERS  : taskId : priority of the task, 0 is the highest,
+* 						 max. SCHEDULER_MAX_TASKS - 1
+* 				task   : one step of the task
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Scheduler_AddTask(U8_t taskId, SCHEDULER_task_t task)
+{
+	tasks_list[taskId] = task;
+	EF_void_Scheduler_Wakeup(taskId);
+}
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_Wakeup
+*
+* DESCRIPTION : make the task ready, it runs once even if it is woken many
+* 				times before. can be called from the main loop and from ISRs.
+*
+* PARAMETERS  : taskId
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Scheduler_Wakeup(U8_t taskId)
+{
+	U8_t sreg = SREG;
+
+	cli();
+	ready_tasks |= (1 << taskId);
+	SREG = sreg;
+}
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_WakeOnTimer
+*
+* DESCRIPTION : wake the task each time the timer times out. Many tasks can
+* 				be woken by the same timer. The timer is created and started
+* 				by the caller.
+*
+* PARAMETERS  : taskId
+* 				timerNumber : Timer ID of EF_SpechialTIMER
+* 				mode        : TIMER_MODE_PERIODIC or TIMER_MODE_ONE_SHOT
+*
+* Return Value: None.
+*
+* NOTE		  : the timer callback is used by the scheduler
+******************************************************************************/
+void EF_void_Scheduler_WakeOnTimer(U8_t taskId, U8_t timerNumber, U8_t mode)
+{
+	U8_t sreg = SREG;
+
+	cli();
+	timer_wake[timerNumber] |= (1 << taskId);
+	SREG = sreg;
+	/* the wakeup is short, it is done in the ISR */
+	EF_void_TimerSetCallback(timerNumber, EF_void_Scheduler_TimerElapsed, mode & ~TIMER_MODE_DEFERRED);
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Scheduler_RunNext
+*
+* DESCRIPTION : run one step of the ready task with the highest priority.
+*
+* PARAMETERS  : None.
+*
+* Return Value: FALSE if no task was ready.
+*
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_Scheduler_RunNext(void)
+{
+	U8_t taskId = 0;
+	U8_t mask   = 0x01;
+	U8_t sreg;
+
+	if(ready_tasks == 0)
+	{
+		return FALSE;
+	}
+	while((ready_tasks & mask) == 0)
+	{
+		mask <<= 1;
+		taskId++;
+	}
+
+	sreg = SREG;
+	cli();
+	ready_tasks &= ~mask;
+	SREG = sreg;
+
+	if(tasks_list[taskId] != NULL && tasks_list[taskId]() == TRUE)
+	{
+		EF_void_Scheduler_Wakeup(taskId);
+	}
+	return TRUE;
+}
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_Run
+*
+* DESCRIPTION : run the ready tasks forever, the CPU sleeps in
+* 				SCHEDULER_SLEEP_MODE while no task is ready.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None, never returns.
+*
+******************************************************************************/
+void EF_void_Scheduler_Run(void)
+{
+	for(;;)
+	{
+		if(EF_BOOLEAN_Scheduler_RunNext() == TRUE)
+		{
+			continue;
+		}
+
+		/* a wakeup between the check and the sleep would be lost: check with
+		 * disabled interrupts, sei() takes effect after the sleep instruction */
+		cli();
+		if(ready_tasks == 0)
+		{
+			sleep_enable();
+			sei();
+			sleep_cpu();
+			sleep_disable();
+		}
+		sei();
+	}
+}
@@ -0,0 +1,118 @@
+/***************************************************************
+ *  Source File: EF_Scheduler.h
+ *
+ *  Description: cooperative run to completion scheduler for the main loop
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+#ifndef _SCHEDULER_H__
+#define _SCHEDULER_H__
+
+#include "EF_Scheduler_cfg.h"
+
+
+/*************************************************
+ * 	 API functions
+ *************************************************/
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_Init
+*
+* DESCRIPTION : remove all tasks, nothing is ready.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Scheduler_Init(void);
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_AddTask
+*
+* DESCRIPTION : add a task, it is ready to run once.
+*
+* PARAMETERS  : taskId : priority of the task, 0 is the highest,
+* 						 max. SCHEDULER_MAX_TASKS - 1
+* 				task   : one step of the task
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Scheduler_AddTask(U8_t taskId, SCHEDULER_task_t task);
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_Wakeup
+*
+* DESCRIPTION : make the task ready, it runs once even if it is woken many
+* 				times before. can be called from the main loop and from ISRs.
+*
+* PARAMETERS  : taskId
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Scheduler_Wakeup(U8_t taskId);
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_WakeOnTimer
+*
+* DESCRIPTION : wake the task each time the timer times out. Many tasks can
+* 				be woken by the same timer. The timer is created and started
+* 				by the caller.
+*
+* PARAMETERS  : taskId
+* 				timerNumber : Timer ID of EF_SpechialTIMER
+* 				mode        : TIMER_MODE_PERIODIC or TIMER_MODE_ONE_SHOT
+*
+* Return Value: None.
+*
+* NOTE		  : the timer callback is used by the scheduler
+******************************************************************************/
+extern void EF_void_Scheduler_WakeOnTimer(U8_t taskId, U8_t timerNumber, U8_t mode);
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Scheduler_RunNext
+*
+* DESCRIPTION : run one step of the ready task with the highest priority.
+*
+* PARAMETERS  : None.
+*
+* Return Value: FALSE if no task was ready.
+*
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_Scheduler_RunNext(void);
+
+/****************************************************************************
+* Function    : EF_void_Scheduler_Run
+*
+* DESCRIPTION : run the ready tasks forever, the CPU sleeps in
+* 				SCHEDULER_SLEEP_MODE while no task is ready.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None, never returns.
+*
+******************************************************************************/
+extern void EF_void_Scheduler_Run(void);
+
+#endif
@@ -0,0 +1,56 @@
+/***************************************************************
+ *  Source File: EF_Scheduler_cfg.h
+ *
+ *  Description: cooperative run to completion scheduler for the main loop
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#ifndef SCHEDULER_CFG_H_
+#define SCHEDULER_CFG_H_
+
+#include "std_types.h"
+#include "EF_SpechialTIMER.h"
+
+/**************************************************
+ * Definitions
+ **************************************************/
+/* the task ID is its priority, 0 is the highest. One bit per task in the
+ * ready mask, max. 8 tasks */
+#define SCHEDULER_MAX_TASKS			8
+
+/* nothing is ready: the CPU sleeps until the next interrupt. In idle mode
+ * Timer2 and the UART keep running */
+#define SCHEDULER_SLEEP_MODE		SLEEP_MODE_IDLE
+
+/**************************************************
+ * configuration types
+ *************************************************/
+/* one step of the task, must not block. Returns TRUE if it has more work,
+ * then it is ready again after the tasks with higher priority */
+typedef BOOLEAN (*SCHEDULER_task_t)(void);
+
+#if (SCHEDULER_MAX_TASKS > 8)
+#error "the ready mask has 8 bits"
+#endif
+
+#endif
@@ -26,12 +26,111 @@
 
  **************************************************************/
 
+#include <avr/io.h>
+#include <avr/interrupt.h>
 #include "EF_SpechialTIMER.h"
 
 /**************************************************
  * 	global variables
  *************************************************/
 static TIMER_ID_str timers_list[MAX_NUMBER_OF_TIMERS];
+static void (*tickHookPtr)(void) = NULL;	/* extra work on every system tick */
+static void (*dispatchHookPtr)(void) = NULL;	/* a deferred callback is queued   */
+
+/* system ticks since EF_void_TimerInit, the enabled timers expire at timers_list[].expiry */
+static volatile U32_t timer_ticks;
+/* enabled timers sorted by their expiry, the ISR only looks at the first one */
+static volatile U8_t  timer_head = TIMER_NONE;
+
+/* expired deferred timers, filled in the ISR and emptied in the main loop */
+static volatile U8_t timer_queue[TIMER_QUEUE_SIZE];
+static volatile U8_t queue_head;		/* next free entry  */
+static volatile U8_t queue_tail;		/* oldest entry     */
+
+/**************************************************
+ * 	local functions, called with disabled interrupts
+ *************************************************/
+/* ticks until the timer expires, the timer must be enabled */
+static U32_t EF_u32_TimerRemaining(U8_t timerNumber)
+{
+	return timers_list[timerNumber].expiry - timer_ticks;
+}
+
+/* insert the timer in the expiry list after the timers which expire at the same tick */
+static void EF_void_TimerInsert(U8_t timerNumber, U32_t remaining)
+{
+	U8_t previous = TIMER_NONE;
+	U8_t current  = timer_head;
+
+	timers_list[timerNumber].expiry = timer_ticks + remaining;
+	while(current != TIMER_NONE && EF_u32_TimerRemaining(current) <= remaining)
+	{
+		previous = current;
+		current  = timers_list[current].next;
+	}
+	timers_list[timerNumber].next = current;
+	if(previous == TIMER_NONE)
+	{
+		timer_head = timerNumber;
+	}
+	else
+	{
+		timers_list[previous].next = timerNumber;
+	}
+}
+
+static void EF_void_TimerRemove(U8_t timerNumber)
+{
+	U8_t previous = TIMER_NONE;
+	U8_t current  = timer_head;
+
+	while(current != TIMER_NONE && current != timerNumber)
+	{
+		previous = current;
+		current  = timers_list[current].next;
+	}
+	if(current == TIMER_NONE)
+	{
+		return;
+	}
+	if(previous == TIMER_NONE)
+	{
+		timer_head = timers_list[timerNumber].next;
+	}
+	else
+	{
+		timers_list[previous].next = timers_list[timerNumber].next;
+	}
+}
+
+/* counts since the start of the period */
+static U32_t EF_u32_TimerElapsed(U8_t timerNumber)
+{
+	if(timers_list[timerNumber].isEnables == TRUE)
+	{
+		return timers_list[timerNumber].timeOut - EF_u32_TimerRemaining(timerNumber);
+	}
+	return timers_list[timerNumber].counter;
+}
+
+/* enable the timer, it expires when counter reaches timeOut */
+static void EF_void_TimerEnable(U8_t timerNumber)
+{
+	U32_t timeOut = timers_list[timerNumber].timeOut;
+	U32_t counter = timers_list[timerNumber].counter;
+
+	/* the time out may have been changed below the counter */
+	EF_void_TimerInsert(timerNumber, (counter < timeOut) ? (timeOut - counter) : 1);
+	timers_list[timerNumber].isEnables = TRUE;
+}
+
+/* disable the timer, the counts are kept in counter */
+static void EF_void_TimerDisable(U8_t timerNumber)
+{
+	timers_list[timerNumber].counter = EF_u32_TimerElapsed(timerNumber);
+	EF_void_TimerRemove(timerNumber);
+	timers_list[timerNumber].isEnables = FALSE;
+}
 
 /****************************************************************************
 * Function    : void_SCHEDULER_timerISRCallback
@@ -48,6 +147,47 @@ static void EF_void_TimerISRCallback(void)
 {
 	//count the enabled timer and if it reached the timeOut ,counter=0 and set timeOut Flag
 	EF_void_TimersUpdate();
+
+	if(tickHookPtr != NULL)
+	{
+		tickHookPtr();
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_TimerSetTickHook
+*
+* DESCRIPTION : attach a function which is called in the Timer ISR on every
+* 				system tick (SYSTEMTICKTIME), after the timers are updated.
+* 				must be short, it runs with interrupts disabled.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None
+******************************************************************************/
+void EF_void_TimerSetTickHook(void (*hook)(void))
+{
+	tickHookPtr = hook;
+}
+
+/****************************************************************************
+* Function    : EF_void_TimerSetDispatchHook
+*
+* DESCRIPTION : attach a function which is called in the Timer ISR when the
+* 				callback of a deferred timer is queued, e.g. to wake the task
+* 				which calls EF_BOOLEAN_TimerDispatch(). must be short.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None
+******************************************************************************/
+void EF_void_TimerSetDispatchHook(void (*hook)(void))
+{
+	U8_t sreg = SREG;
+
+	cli();
+	dispatchHookPtr = hook;
+	SREG = sreg;
 }
 
 /****************************************************************************
@@ -62,6 +202,16 @@ static void EF_void_TimerISRCallback(void)
 ******************************************************************************/
 void EF_void_TimerDelete(U8_t timerNumber)
 {
+	U8_t sreg = SREG;
+
+	cli();
+	if(timers_list[timerNumber].isEnables == TRUE)
+	{
+		EF_void_TimerRemove(timerNumber);
+	}
+	timers_list[timerNumber].callback   =  NULL;
+	timers_list[timerNumber].mode       =  TIMER_MODE_PERIODIC;
+	SREG = sreg;
 	timers_list[timerNumber].counter    = 0;
 	timers_list[timerNumber].timeOut    = 0;
 	timers_list[timerNumber].isTimedout =  FALSE;
@@ -87,8 +237,13 @@ void EF_void_TimerInit(void)
 	// set the timer interrupt callback
 	EF_void_Timer_SetISRCallBack(EF_void_TimerISRCallback);
 	// set all Timers to the initial state
+	timer_head  = TIMER_NONE;
+	timer_ticks = 0;
+	queue_head  = 0;
+	queue_tail  = 0;
 	for( timersCounter=0 ; timersCounter < MAX_NUMBER_OF_TIMERS ; timersCounter++ )
 	{
+		timers_list[timersCounter].isQueued = FALSE;
 		EF_void_TimerDelete(timersCounter);
 	}
 }
@@ -134,31 +289,135 @@ void EF_void_TimerCreate(U8_t timerNumber , U32_t timerTimeout) /* Timer timeout
 /****************************************************************************
 * Function    : EF_void_TimersUpdate
 *
-* DESCRIPTION : count the enabled timer and if it reached the timeOut ,counter=0 and set timeOut Flag
+* DESCRIPTION : count the system tick, the timers which expire now set their
+* 				timeOut Flag and start the next period.
 * 				this function called in the ISR by call back function.
 *
 * PARAMETERS  : None.
 *
 * Return Value: None.
 *
+* NOTE		  : only the expiring timers are touched, the other enabled timers
+* 				wait in the expiry list. The callbacks of the expired timers are
+* 				called here or queued for EF_BOOLEAN_TimerDispatch().
 ******************************************************************************/
 void EF_void_TimersUpdate(void)
 {
-	U16_t timersCounter = 0;
+	U8_t timerNumber;
+	TIMER_callback_t callback;
+
+	timer_ticks++;
 
-	for( timersCounter = 0 ; timersCounter < MAX_NUMBER_OF_TIMERS ; timersCounter++ )
+	while(timer_head != TIMER_NONE && timers_list[timer_head].expiry == timer_ticks)
 	{
-		if(timers_list[timersCounter].isEnables == TRUE)
+		timerNumber = timer_head;
+		timer_head  = timers_list[timerNumber].next;
+
+		timers_list[timerNumber].isTimedout = TRUE;
+		if(timers_list[timerNumber].mode & TIMER_MODE_ONE_SHOT)
+		{
+			timers_list[timerNumber].counter   = 0;
+			timers_list[timerNumber].isEnables = FALSE;
+		}
+		else
 		{
-			timers_list[timersCounter].counter++ ;
+			EF_void_TimerInsert(timerNumber, timers_list[timerNumber].timeOut);
+		}
 
-			if(timers_list[timersCounter].counter == timers_list[timersCounter].timeOut)
+		callback = timers_list[timerNumber].callback;
+		if(callback == NULL)
+		{
+			continue;
+		}
+		if(timers_list[timerNumber].mode & TIMER_MODE_DEFERRED)
+		{
+			/* a timer which is still waiting isn't queued twice */
+			if(timers_list[timerNumber].isQueued == FALSE)
 			{
-				timers_list[timersCounter].counter = 0;
-				timers_list[timersCounter].isTimedout = TRUE;
+				timers_list[timerNumber].isQueued = TRUE;
+				timer_queue[queue_head] = timerNumber;
+				queue_head = (queue_head + 1) & TIMER_QUEUE_MASK;
+				if(dispatchHookPtr != NULL)
+				{
+					dispatchHookPtr();
+				}
 			}
 		}
+		else
+		{
+			/* the list is consistent, the callback may start or stop timers */
+			callback(timerNumber);
+		}
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_TimerSetCallback
+*
+* DESCRIPTION : attach a function which is called when the timer times out and
+* 				choose the behaviour after the time out.
+*
+* PARAMETERS  : timerNumber : Timer ID
+* 				callback    : called with timerNumber, NULL for polling with
+* 							  EF_BOOLEAN_TimerCheck() only
+* 				mode        : TIMER_MODE_PERIODIC or TIMER_MODE_ONE_SHOT, can be
+* 							  ORed with TIMER_MODE_DEFERRED
+*
+* Return Value: None.
+*
+* NOTE		  : without TIMER_MODE_DEFERRED the callback runs in the Timer ISR
+* 				and must be short. The timeout Flag is set in all modes.
+******************************************************************************/
+void EF_void_TimerSetCallback(U8_t timerNumber, TIMER_callback_t callback, U8_t mode)
+{
+	U8_t sreg = SREG;
+
+	cli();
+	timers_list[timerNumber].callback = callback;
+	timers_list[timerNumber].mode     = mode;
+	SREG = sreg;
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_TimerDispatch
+*
+* DESCRIPTION : call the callbacks of the deferred timers which expired since
+* 				the last call, in the order of their time out.
+* 				called once per main loop iteration.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE if a callback was called.
+*
+* NOTE		  : timers which expire during the callbacks wait for the next call
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_TimerDispatch(void)
+{
+	BOOLEAN called = FALSE;
+	U8_t    timerNumber;
+	U8_t    last;
+	TIMER_callback_t callback;
+	U8_t    sreg;
+
+	last = queue_head;
+	while(queue_tail != last)
+	{
+		sreg = SREG;
+		cli();
+		timerNumber = timer_queue[queue_tail];
+		queue_tail  = (queue_tail + 1) & TIMER_QUEUE_MASK;
+		/* NULL if the timer was deleted since it was queued */
+		callback = timers_list[timerNumber].callback;
+		timers_list[timerNumber].isQueued = FALSE;
+		SREG = sreg;
+
+		if(callback != NULL)
+		{
+			callback(timerNumber);
+			called = TRUE;
+		}
 	}
+	return called;
 }
 /****************************************************************************
 * Function    : EF_BOOLEAN_TimerCheck
@@ -192,10 +451,14 @@ BOOLEAN EF_BOOLEAN_TimerCheck(U8_t timerNumber)
 ******************************************************************************/
 void EF_void_TimerStart(U8_t timerNumber)
 {
-	if(timers_list[timerNumber].timeOut != 0)
+	U8_t sreg = SREG;
+
+	cli();
+	if(timers_list[timerNumber].timeOut != 0 && timers_list[timerNumber].isEnables == FALSE)
 	{
-		timers_list[timerNumber].isEnables = TRUE;
+		EF_void_TimerEnable(timerNumber);
 	}
+	SREG = sreg;
 }
 
 
@@ -227,7 +490,24 @@ BOOLEAN EF_u8_TimerIsEnabled(U8_t timerNumber)
 ******************************************************************************/
 void EF_void_TimerChangeTimeOut(U8_t timerNumber ,U32_t NewTimeOut)
 {
-    timers_list[timerNumber].timeOut = NewTimeOut;
+	U8_t sreg = SREG;
+
+	cli();
+	if(timers_list[timerNumber].isEnables == TRUE)
+	{
+		/* the counts of this period are kept */
+		EF_void_TimerDisable(timerNumber);
+		timers_list[timerNumber].timeOut = NewTimeOut;
+		if(NewTimeOut != 0)
+		{
+			EF_void_TimerEnable(timerNumber);
+		}
+	}
+	else
+	{
+		timers_list[timerNumber].timeOut = NewTimeOut;
+	}
+	SREG = sreg;
 }
 
 
@@ -242,7 +522,13 @@ void EF_void_TimerChangeTimeOut(U8_t timerNumber ,U32_t NewTimeOut)
 ******************************************************************************/
 U32_t EF_u32_TimerGetCounterValue (U8_t timerNumber )
 {
-    return ( timers_list[timerNumber].counter);
+	U32_t counter;
+	U8_t  sreg = SREG;
+
+	cli();
+	counter = EF_u32_TimerElapsed(timerNumber);
+	SREG = sreg;
+	return counter;
 }
 
 /****************************************************************************
@@ -257,7 +543,14 @@ U32_t EF_u32_TimerGetCounterValue (U8_t timerNumber )
 ******************************************************************************/
 void EF_void_TimerStop(U8_t timerNumber)
 {
-	timers_list[timerNumber].isEnables = FALSE;
+	U8_t sreg = SREG;
+
+	cli();
+	if(timers_list[timerNumber].isEnables == TRUE)
+	{
+		EF_void_TimerDisable(timerNumber);
+	}
+	SREG = sreg;
 }
 /****************************************************************************
 * Function    : EF_void_TimerReset
@@ -271,7 +564,17 @@ void EF_void_TimerStop(U8_t timerNumber)
 ******************************************************************************/
 void EF_void_TimerReset(U8_t timerNumber)
 {
+	U8_t sreg = SREG;
+
+	cli();
 	timers_list[timerNumber].counter = 0;
+	if(timers_list[timerNumber].isEnables == TRUE)
+	{
+		/* a new period starts now */
+		EF_void_TimerRemove(timerNumber);
+		EF_void_TimerEnable(timerNumber);
+	}
+	SREG = sreg;
 }
 
 /****************************************************************************
@@ -285,8 +588,16 @@ void EF_void_TimerReset(U8_t timerNumber)
 ******************************************************************************/
 void EF_void_Timer_TurnOff(U8_t timerNumber)
 {
+	U8_t sreg = SREG;
+
+	cli();
+	if(timers_list[timerNumber].isEnables == TRUE)
+	{
+		EF_void_TimerRemove(timerNumber);
+	}
     timers_list[timerNumber].counter = 0;
     timers_list[timerNumber].isEnables = FALSE;
     // Note: that I added this Line
     timers_list[timerNumber].isTimedout = FALSE;
+	SREG = sreg;
 }
@@ -85,15 +85,79 @@ BOOLEAN EF_BOOLEAN_Timer_IsTimedOut(U8_t timerNumber);
 /****************************************************************************
 * Function    : EF_void_TimersUpdate
 *
-* DESCRIPTION : count the enabled timer and if it reached the timeOut ,counter=0 and set timeOut Flag
+* DESCRIPTION : count the system tick, the timers which expire now set their
+* 				timeOut Flag and start the next period.
 * 				this function called in the ISR by call back function.
 *
 * PARAMETERS  : None.
 *
 * Return Value: None.
 *
+* NOTE		  : only the expiring timers are touched, the other enabled timers
+* 				wait in the expiry list. The callbacks of the expired timers are
+* 				called here or queued for EF_BOOLEAN_TimerDispatch().
 ******************************************************************************/
 extern void EF_void_TimersUpdate(void);
+
+/****************************************************************************
+* Function    : EF_void_TimerSetCallback
+*
+* DESCRIPTION : attach a function which is called when the timer times out and
+* 				choose the behaviour after the time out.
+*
+* PARAMETERS  : timerNumber : Timer ID
+* 				callback    : called with timerNumber, NULL for polling with
+* 							  EF_BOOLEAN_TimerCheck() only
+* 				mode        : TIMER_MODE_PERIODIC or TIMER_MODE_ONE_SHOT, can be
+* 							  ORed with TIMER_MODE_DEFERRED
+*
+* Return Value: None.
+*
+* NOTE		  : without TIMER_MODE_DEFERRED the callback runs in the Timer ISR
+* 				and must be short. The timeout Flag is set in all modes.
+******************************************************************************/
+extern void EF_void_TimerSetCallback(U8_t timerNumber, TIMER_callback_t callback, U8_t mode);
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_TimerDispatch
+*
+* DESCRIPTION : call the callbacks of the deferred timers which expired since
+* 				the last call, in the order of their time out.
+* 				called once per main loop iteration.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE if a callback was called.
+*
+* NOTE		  : timers which expire during the callbacks wait for the next call
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_TimerDispatch(void);
+
+/****************************************************************************
+* Function    : EF_void_TimerSetTickHook
+*
+* DESCRIPTION : attach a function which is called in the Timer ISR on every
+* 				system tick (SYSTEMTICKTIME), after the timers are updated.
+* 				must be short, it runs with interrupts disabled.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None
+******************************************************************************/
+extern void EF_void_TimerSetTickHook(void (*hook)(void));
+
+/****************************************************************************
+* Function    : EF_void_TimerSetDispatchHook
+*
+* DESCRIPTION : attach a function which is called in the Timer ISR when the
+* 				callback of a deferred timer is queued, e.g. to wake the task
+* 				which calls EF_BOOLEAN_TimerDispatch(). must be short.
+*
+* PARAMETERS  : hook : pointer to the function, NULL to detach
+*
+* Return Value: None
+******************************************************************************/
+extern void EF_void_TimerSetDispatchHook(void (*hook)(void));
 /****************************************************************************
 * Function    : EF_BOOLEAN_TimerCheck
 *
@@ -34,7 +34,7 @@
 /**************************************************
  * Definitions
  **************************************************/
-#define MAX_NUMBER_OF_TIMERS   		10
+#define MAX_NUMBER_OF_TIMERS   		12
 
 /* different IDs*/
 #define THREE_SEC_TIMER_ID 			0
@@ -46,6 +46,9 @@
 #define UART_TIMER_ID				6
 #define SPI_TIMER_ID				7
 #define NRF_SEND_ID                 8
+#define RENDER_TIMER_ID				9
+#define MENU_TIMER_ID				10
+#define TRANSACTION_TIMER_ID		11
 
 /* using with Special Timer to able  SPI Function to be unstuck */
 #define SPI_TIMEOUT  				100/SYSTEMTICKTIME
@@ -56,12 +59,38 @@
  * configuration types
  *************************************************/
 
+/* end of the expiry list */
+#define TIMER_NONE					0xFF
+
+/* timer modes, EF_void_TimerSetCallback() */
+#define TIMER_MODE_PERIODIC			0x00	/* start the next period after the time out   */
+#define TIMER_MODE_ONE_SHOT			0x01	/* stop after the time out                    */
+#define TIMER_MODE_DEFERRED			0x02	/* callback from EF_BOOLEAN_TimerDispatch() in
+ 	 	 	 	 	 	 	 	 	 	 	 	 * the main loop instead of the Timer ISR    */
+
+/* expired deferred timers waiting for EF_BOOLEAN_TimerDispatch(), a timer is
+ * queued only once so MAX_NUMBER_OF_TIMERS entries are enough */
+#define TIMER_QUEUE_SIZE			16		/* power of 2 */
+#define TIMER_QUEUE_MASK			(TIMER_QUEUE_SIZE - 1)
+
+#if (MAX_NUMBER_OF_TIMERS > TIMER_QUEUE_SIZE)
+#error "TIMER_QUEUE_SIZE must hold all timers"
+#endif
+
+/* called with the number of the expired timer */
+typedef void (*TIMER_callback_t)(U8_t timerNumber);
+
 typedef struct timer_struct
 {
   volatile U32_t   timeOut ;     /* max. time counts                	 */
-  volatile U32_t   counter ;	 /* count every Timer Interrupt happened */
+  volatile U32_t   counter ;	 /* counts of the period while disabled  */
+  volatile U32_t   expiry ;		 /* system tick of the time out while enabled */
+  volatile U8_t    next ;		 /* next timer in the expiry list        */
   volatile BOOLEAN isTimedout;	 /* check if count == timeOut  			 */
   volatile BOOLEAN isEnables;	 /* check if TimerID is Enable 			 */
+  volatile BOOLEAN isQueued;	 /* waiting for EF_BOOLEAN_TimerDispatch */
+  TIMER_callback_t callback;	 /* called at the time out, NULL: polling only */
+  U8_t             mode;		 /* TIMER_MODE_xxx                        */
 }TIMER_ID_str;
 
 
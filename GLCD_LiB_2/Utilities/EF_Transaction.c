@@ -0,0 +1,284 @@
+/***************************************************************
+ *  Source File: EF_Transaction.c
+ *
+ *  Description: request/response transactions with the backend over UART
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include "EF_Transaction.h"
+#include "../MCAL/EF_UART.h"
+
+/**************************************************
+ * 	global variables
+ *************************************************/
+/* receive state machine */
+typedef enum
+{
+	RX_WAIT_STX,
+	RX_SEQUENCE,
+	RX_COMMAND,
+	RX_LENGTH,
+	RX_DATA,
+	RX_CHECKSUM
+}enu_rx_state;
+
+static U8_t tx_frame[TRANSACTION_MAX_DATA + 5];
+static U8_t tx_length;
+
+static enu_rx_state rx_state;
+static U8_t rx_sequence;
+static U8_t rx_command;
+static U8_t rx_length;
+static U8_t rx_index;
+static U8_t rx_sum;
+static U8_t rx_data[TRANSACTION_MAX_DATA];
+
+static U8_t sequence;						/* of the last request            */
+static U8_t retries;						/* repeated requests left         */
+static TRANSACTION_callback_t callbackPtr;	/* NULL: no transaction running   */
+static TRANSACTION_command_t  commandPtr;	/* frames sent by the host        */
+
+/**************************************************
+ * 	local functions
+ *************************************************/
+static void EF_void_Transaction_Send(void)
+{
+	EF_void_UART_SendArray(tx_frame, tx_length);
+	EF_void_Timer_TurnOff(TRANSACTION_TIMER_ID);
+	EF_void_TimerStart(TRANSACTION_TIMER_ID);
+}
+
+static void EF_void_Transaction_Finish(U8_t result, U8_t length)
+{
+	TRANSACTION_callback_t callback = callbackPtr;
+
+	EF_void_Timer_TurnOff(TRANSACTION_TIMER_ID);
+	callbackPtr = NULL;
+	callback(result, rx_data, length);
+}
+
+/* one received byte, returns TRUE when a complete frame with a valid checksum is in rx_xxx */
+static BOOLEAN EF_BOOLEAN_Transaction_RxByte(U8_t byte)
+{
+	BOOLEAN frameComplete = FALSE;
+
+	if(rx_state != RX_WAIT_STX && rx_state != RX_CHECKSUM)
+	{
+		rx_sum += byte;
+	}
+
+	switch(rx_state)
+	{
+	case RX_WAIT_STX:
+		if(byte == TRANSACTION_STX)
+		{
+			rx_sum   = 0;
+			rx_state = RX_SEQUENCE;
+		}
+		break;
+	case RX_SEQUENCE:
+		rx_sequence = byte;
+		rx_state    = RX_COMMAND;
+		break;
+	case RX_COMMAND:
+		rx_command = byte;
+		rx_state   = RX_LENGTH;
+		break;
+	case RX_LENGTH:
+		rx_length = byte;
+		rx_index  = 0;
+		if(rx_length > TRANSACTION_MAX_DATA)
+		{
+			rx_state = RX_WAIT_STX;
+		}
+		else if(rx_length == 0)
+		{
+			rx_state = RX_CHECKSUM;
+		}
+		else
+		{
+			rx_state = RX_DATA;
+		}
+		break;
+	case RX_DATA:
+		rx_data[rx_index++] = byte;
+		if(rx_index == rx_length)
+		{
+			rx_state = RX_CHECKSUM;
+		}
+		break;
+	case RX_CHECKSUM:
+		frameComplete = ((U8_t)(rx_sum + byte) == 0);
+		rx_state = RX_WAIT_STX;
+		break;
+	default:
+		rx_state = RX_WAIT_STX;
+		break;
+	}
+	return frameComplete;
+}
+
+/****************************************************************************
+* Function    : EF_void_Transaction_Init
+*
+* DESCRIPTION : no transaction is running. EF_void_TimerInit() and
+* 				EF_void_UART_Init() must be called before.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Transaction_Init(void)
+{
+	rx_state    = RX_WAIT_STX;
+	sequence    = 0;
+	callbackPtr = NULL;
+	commandPtr  = NULL;
+	EF_void_TimerCreate(TRANSACTION_TIMER_ID, TRANSACTION_TIMEOUT);
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Transaction_Request
+*
+* DESCRIPTION : send a request frame, the answer or the timeout is delivered to
+* 				callback by EF_void_Transaction_Poll(). The request is repeated
+* 				TRANSACTION_RETRIES times if no valid answer is received.
+*
+* PARAMETERS  : command  : CMD_xxx
+* 				data     : request data, copied
+* 				length   : number of data bytes, max. TRANSACTION_MAX_DATA
+* 				callback : receiver of the result
+*
+* Return Value: FALSE if a transaction is already running.
+*
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_Transaction_Request(U8_t command, const U8_t *data, U8_t length,
+		TRANSACTION_callback_t callback)
+{
+	U8_t index;
+	U8_t sum;
+
+	if(callbackPtr != NULL || callback == NULL || length > TRANSACTION_MAX_DATA)
+	{
+		return FALSE;
+	}
+
+	sequence++;
+	tx_frame[0] = TRANSACTION_STX;
+	tx_frame[1] = sequence;
+	tx_frame[2] = command;
+	tx_frame[3] = length;
+	sum = sequence + command + length;
+	for(index = 0; index < length; index++)
+	{
+		tx_frame[4 + index] = data[index];
+		sum += data[index];
+	}
+	tx_frame[4 + length] = (U8_t)(0 - sum);
+	tx_length = length + 5;
+
+	callbackPtr = callback;
+	retries     = TRANSACTION_RETRIES;
+	rx_state    = RX_WAIT_STX;
+	EF_void_Transaction_Send();
+	return TRUE;
+}
+
+/****************************************************************************
+* Function    : EF_void_Transaction_Poll
+*
+* DESCRIPTION : called once per main loop iteration, takes the received bytes
+* 				without waiting and handles the timeout.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Transaction_Poll(void)
+{
+	while(EF_BOOLEAN_UART_CheckForRxData())
+	{
+		if(EF_BOOLEAN_Transaction_RxByte(EF_u8_UART_WaitChar()) == TRUE)
+		{
+			if((rx_command & TRANSACTION_RESPONSE_FLAG) == 0)
+			{
+				if(commandPtr != NULL)
+				{
+					commandPtr(rx_command, rx_data, rx_length);
+				}
+			}
+			/* answers of old or repeated requests are dropped */
+			else if(callbackPtr != NULL && rx_sequence == sequence &&
+					rx_command == (tx_frame[2] | TRANSACTION_RESPONSE_FLAG))
+			{
+				EF_void_Transaction_Finish(TRANSACTION_OK, rx_length);
+				return;
+			}
+		}
+	}
+
+	if(callbackPtr != NULL && EF_BOOLEAN_TimerCheck(TRANSACTION_TIMER_ID))
+	{
+		if(retries > 0)
+		{
+			retries--;
+			EF_void_Transaction_Send();
+		}
+		else
+		{
+			EF_void_Transaction_Finish(TRANSACTION_TIMED_OUT, 0);
+		}
+	}
+}
+
+/****************************************************************************
+* Function    : EF_void_Transaction_SetCommandHandler
+*
+* DESCRIPTION : set the receiver of the frames which are no answers.
+*
+* PARAMETERS  : handler : NULL: these frames are dropped
+*
+* Return Value: None.
+*
+******************************************************************************/
+void EF_void_Transaction_SetCommandHandler(TRANSACTION_command_t handler)
+{
+	commandPtr = handler;
+}
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Transaction_IsBusy
+*
+* DESCRIPTION : check for a running transaction.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE while waiting for an answer.
+*
+******************************************************************************/
+BOOLEAN EF_BOOLEAN_Transaction_IsBusy(void)
+{
+	return (callbackPtr != NULL);
+}
@@ -0,0 +1,117 @@
+/***************************************************************
+ *  Source File: EF_Transaction.h
+ *
+ *  Description: request/response transactions with the backend over UART
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+#ifndef _TRANSACTION_H__
+#define _TRANSACTION_H__
+
+#include "EF_Transaction_cfg.h"
+
+/**************************************************
+ * Types
+ **************************************************/
+/* called from EF_void_Transaction_Poll() when the transaction is finished,
+ * data is only valid during the call */
+typedef void (*TRANSACTION_callback_t)(U8_t result, const U8_t *data, U8_t length);
+
+/* called from EF_void_Transaction_Poll() with each frame the host sends by
+ * itself (command without TRANSACTION_RESPONSE_FLAG), data is only valid
+ * during the call */
+typedef void (*TRANSACTION_command_t)(U8_t command, const U8_t *data, U8_t length);
+
+
+/*************************************************
+ * 	 API functions
+ *************************************************/
+
+/****************************************************************************
+* Function    : EF_void_Transaction_Init
+*
+* DESCRIPTION : no transaction is running. EF_void_TimerInit() and
+* 				EF_void_UART_Init() must be called before.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Transaction_Init(void);
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Transaction_Request
+*
+* DESCRIPTION : send a request frame, the answer or the timeout is delivered to
+* 				callback by EF_void_Transaction_Poll(). The request is repeated
+* 				TRANSACTION_RETRIES times if no valid answer is received.
+*
+* PARAMETERS  : command  : CMD_xxx
+* 				data     : request data, copied
+* 				length   : number of data bytes, max. TRANSACTION_MAX_DATA
+* 				callback : receiver of the result
+*
+* Return Value: FALSE if a transaction is already running.
+*
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_Transaction_Request(U8_t command, const U8_t *data, U8_t length,
+		TRANSACTION_callback_t callback);
+
+/****************************************************************************
+* Function    : EF_void_Transaction_Poll
+*
+* DESCRIPTION : called once per main loop iteration, takes the received bytes
+* 				without waiting and handles the timeout.
+*
+* PARAMETERS  : None.
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Transaction_Poll(void);
+
+/****************************************************************************
+* Function    : EF_void_Transaction_SetCommandHandler
+*
+* DESCRIPTION : set the receiver of the frames which are no answers.
+*
+* PARAMETERS  : handler : NULL: these frames are dropped
+*
+* Return Value: None.
+*
+******************************************************************************/
+extern void EF_void_Transaction_SetCommandHandler(TRANSACTION_command_t handler);
+
+/****************************************************************************
+* Function    : EF_BOOLEAN_Transaction_IsBusy
+*
+* DESCRIPTION : check for a running transaction.
+*
+* PARAMETERS  : None.
+*
+* Return Value: TRUE while waiting for an answer.
+*
+******************************************************************************/
+extern BOOLEAN EF_BOOLEAN_Transaction_IsBusy(void);
+
+#endif
@@ -0,0 +1,56 @@
+/***************************************************************
+ *  Source File: EF_Transaction_cfg.h
+ *
+ *  Description: request/response transactions with the backend over UART
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#ifndef TRANSACTION_CFG_H_
+#define TRANSACTION_CFG_H_
+
+#include "std_types.h"
+#include "EF_SpechialTIMER.h"
+
+/**************************************************
+ * Definitions
+ **************************************************/
+/* frame: STX | sequence | command | length | data[length] | checksum
+ * checksum: two's complement of the sum of sequence .. last data byte,
+ * the response has the sequence of the request and command | RESPONSE_FLAG */
+#define TRANSACTION_STX				0x02
+#define TRANSACTION_RESPONSE_FLAG	0x80
+#define TRANSACTION_MAX_DATA		32
+
+/* time for one answer and number of repeated requests */
+#define TRANSACTION_TIMEOUT			(500/SYSTEMTICKTIME)
+#define TRANSACTION_RETRIES			2
+
+/* commands of the backend, sent by the device */
+#define CMD_AUTHENTICATE			0x01	/* response: 1 byte, 1 = verified        */
+#define CMD_GET_DISCOUNT			0x02	/* response: 2 bytes, coins (MSB first)  */
+
+/* transaction result */
+#define TRANSACTION_OK				0
+#define TRANSACTION_TIMED_OUT		1
+
+#endif
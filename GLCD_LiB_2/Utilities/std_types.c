@@ -1,5 +1,7 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
 #include "std_types.h"
 
 
@@ -59,3 +61,27 @@ void EF_ArrayCopy ( U8_t * Dest_Address, U8_t* Src_Address, U16_t CopiedBytesLen
 	}
 	NumberASCII_ptr [NumberOfDigits] = 0;
 }
+
+
+
+/*********************************************************************
+* Function    :  EF_u32_AtomicRead
+*
+* DESCRIPTION : read a 32 bit variable which is changed in an ISR, the 4 bytes
+*               are read with the interrupts disabled so they belong together.
+*
+* PARAMETERS  : Variable_ptr : pointer to the variable
+*
+* Return Value: value of the variable
+**********************************************************************/
+U32_t EF_u32_AtomicRead (const volatile U32_t * Variable_ptr)
+{
+	U32_t Value;
+	U8_t  sreg = SREG;
+
+	cli();
+	Value = *Variable_ptr;
+	SREG = sreg;
+
+	return Value;
+}
@@ -101,4 +101,6 @@ extern void EF_ArrayCopy ( U8_t * Dest_Address, U8_t* Src_Address, U16_t CopiedB
 
 void itoa_Convert (U32_t Number , U8_t * NumberASCII_ptr ,U8_t* NumberOFDigits_ptr);
 
+extern U32_t EF_u32_AtomicRead (const volatile U32_t * Variable_ptr);
+
 #endif
@@ -42,8 +42,19 @@
 #include <avr/io.h>
 #endif
 #include "util/delay.h"
+#include <stdlib.h>
+#include <string.h>
 
 #include "MCAL/EF_UART.h"
+#include "Utilities/EF_SpechialTIMER.h"
+#include "Utilities/EF_Render.h"
+#include "HAL/EF_Keys.h"
+#include "Utilities/EF_Menu.h"
+#include "Utilities/EF_Transaction.h"
+#include "Utilities/EF_Frame.h"
+#include "Utilities/EF_Mirror.h"
+#include "Utilities/EF_Scene.h"
+#include "Utilities/EF_Scheduler.h"
 
 #include "menu.h"
 
@@ -56,11 +67,6 @@
 
 
 
-#define KEY_NONE 0
-#define KEY_PREV 1
-#define KEY_NEXT 2
-#define KEY_SELECT 3
-#define KEY_BACK 4
 
 
 
@@ -107,17 +113,18 @@ static char memory_card_28_bits[] U8G_PROGMEM = {
 u8g_t u8g;
 uint8_t draw_state = 0;
 
-uint8_t volatile homeDisplay_flag = 0;
-uint8_t volatile setupDisplay_flag = 0;
+/* scheduler tasks, the ID is the priority */
+#define TASK_INPUT		0	/* keys                                  */
+#define TASK_COMMS		1	/* transactions and commands of the host */
+#define TASK_APP		2	/* menu background tasks, deferred timers */
+#define TASK_DISPLAY	3	/* one page per step                     */
 
 
 
-uint8_t sys_key_first = KEY_NONE;
-uint8_t sys_key_second = KEY_NONE;
-uint8_t sys_key_code = KEY_NONE;
 
 
-static UART_cfg_str uart_cfg1 = {9600, 8, ONE_STOP_BIT, NO_PARITY, FALSE, FALSE, TRUE, TRUE};
+
+static UART_cfg_str uart_cfg1 = {9600, 8, ONE_STOP_BIT, NO_PARITY, TRUE, FALSE, TRUE, TRUE};
 
 
 
@@ -125,7 +132,7 @@ static UART_cfg_str uart_cfg1 = {9600, 8, ONE_STOP_BIT, NO_PARITY, FALSE, FALSE,
 
 void u8g_setup(void)
 {
-	  u8g_InitSPI(&u8g, &u8g_dev_st7920_128x64_hw_spi, PN(1, 7), PN(1, 5), PN(1, 4), U8G_PIN_NONE, U8G_PIN_NONE);
+	  /* starts the init sequence of the display, it continues in display_task() */
 	  u8g_InitHWSPI(&u8g, &u8g_dev_st7920_128x64_hw_spi, PN(1, 4), U8G_PIN_NONE, U8G_PIN_NONE);
 	  EF_void_UART_Init(&uart_cfg1);
 
@@ -155,27 +162,8 @@ void sys_init(void)
 }
 
 
-void sys_setup_keys(void)
-{
-#if defined(__AVR__)
-  /* configure buttons (inputs with pullup) */
-  DDRD &= ~(1<<5);
-  PORTD |= (1<<5);
-  DDRD &= ~(1<<6);
-  PORTD |= (1<<6);
-  DDRD &= ~(1<<7);
-  PORTD |= (1<<7);
-//  DDRB &= ~(1<<7);
-//  PORTB |= (1<<7);
-#endif
-}
-
-
-
 void u8g_prepare(void) {
 
-  sys_setup_keys();
-
 
   u8g_SetFont(&u8g, u8g_font_profont10);
 
@@ -239,448 +227,318 @@ void u8g_ascii_2(void) {
 }
 
 
-void U8g_welcom(void)
+static void draw_welcome(u8g_t *p)
 {
-//
-
-	  u8g_DrawStr(&u8g,50,15, "Welcome");
-	  u8g_DrawStr(&u8g,40,31, "Embeddedfab");
-
-	  u8g_DrawXBMP(&u8g,10,15,28,28,tools_28_bits);
-
-//	  _delay_ms(150);
-
+	u8g_DrawStr(p,50,15, "Welcome");
+	u8g_DrawStr(p,40,31, "Embeddedfab");
 
+	u8g_DrawXBMP(p,10,15,28,28,tools_28_bits);
 }
 
-uint8_t sys_get_key(void)
+static void draw_memory_card(u8g_t *p)
 {
-  uint8_t volatile result = KEY_NONE;
-
-
-#if defined(__AVR__)
-  if ( (PIND & (1<<5)) == 0 )
-	  result = KEY_NEXT;
-
-  if ( (PIND & (1<<6)) == 0 )
-	  result = KEY_PREV;
-
-  if ( (PIND & (1<<7)) == 0 )
-    result |= KEY_SELECT;
-//  if ( (PINB & (1<<7)) == 0 )
-//    result |= KEY_BACK;
-#endif
-
-//  EF_void_UART_SendString("the key pressed ");
-//   EF_void_UART_Send_Integer(result);
-//   EF_void_UART_SendString("\n");
-
-
-
-  return result;
-
-
-
+	u8g_DrawStr(p,30,5, "Memory Card");
+	u8g_DrawXBMP(p,50,25,28,28,memory_card_28_bits);
 }
 
-
-
-void sys_debounce_key(void)
+static void draw_clock(u8g_t *p)
 {
-  sys_key_second = sys_key_first;
-  sys_key_first = sys_get_key();
-
-  if ( sys_key_second == sys_key_first )
-    sys_key_code = sys_key_first;
-  else
-    sys_key_code = KEY_NONE;
+	u8g_DrawStr(p,40,5,"Clock");
+	u8g_DrawXBMP(p,40,25,28,28,clock_28_bits);
 }
 
+/* result of the running check, the wait screens show it when it is done */
+static BOOLEAN check_done;
+static U8_t    check_result;		/* TRANSACTION_xxx */
+static U8_t    check_answer[2];
 
-#define MENU_ITEMS 4
-char *menu_strings[MENU_ITEMS] = { "1) Enter Machine Number", "2) Enter User Name ", "3) Enter Your Password", "4) Check Authentication" };
-
-#define HOME_MENU_ITEMS 4
-char *home_menu_strings[MENU_ITEMS] = { "1) My Services ", "2) Software Update ", "3) About the device", "4) Shut Down" };
-
-#define COINS_MENU_ITEMS 4
-char *coins_menu_strings[MENU_ITEMS] = { "1) Enter Customer Pin", "2) Enter Customer Code ", "3) Check Customer Discount  ", "4) Thank you" };
-
-
-
-volatile uint8_t menu_current = 0;
-volatile uint8_t menu_redraw_required = 0;
-uint8_t last_key_code = KEY_NONE;
-
-void draw_menu(void)
+static void draw_authentication(u8g_t *p)
 {
-  uint8_t i, h;
-  u8g_uint_t w, d;
-
-//  u8g_SetFont(&u8g, u8g_font_5x7);
-  u8g_SetFontRefHeightText(&u8g);
-  u8g_SetDefaultForegroundColor(&u8g);
-
-  u8g_SetFontPosTop(&u8g);
-
-
-
-
-  u8g_DrawStr(&u8g, 15, 3,"Setup Menu");
-
-  h = u8g_GetFontAscent(&u8g)-u8g_GetFontDescent(&u8g);
-  w = u8g_GetWidth(&u8g);
-  for( i = 0; i < MENU_ITEMS; i++ )
-  {
-//    d = (w-u8g_GetStrWidth(&u8g, menu_strings[i]))/2;
-    u8g_SetDefaultForegroundColor(&u8g);
-    if ( i == menu_current )
-    {
-      u8g_DrawBox(&u8g, 0, (i+2)*h+1, w, h);
-      u8g_SetDefaultBackgroundColor(&u8g);
-
-    }
-//    u8g_DrawStr(&u8g, d, i*h, menu_strings[i]);
-    u8g_DrawStr(&u8g, 0, ((i+2)*h), menu_strings[i]);
-
-  }
-
+	u8g_SetFontRefHeightExtendedText(p);
+	u8g_DrawStr(p,35,15,"Please Wait...");
+	u8g_DrawStr(p,15,25,"check authentication ");
+	if (check_done == TRUE)
+	{
+		if (check_result != TRANSACTION_OK)
+			u8g_DrawStr(p,40,45,"No Answer");
+		else if (check_answer[0] == 1)
+			u8g_DrawStr(p,35,45,"User Verified");
+		else
+			u8g_DrawStr(p,35,45,"Access Denied");
+	}
 }
 
-
-
-
-
-void draw_home_menu(void)
+static void draw_discount(u8g_t *p)
 {
-  uint8_t i, h;
-  u8g_uint_t w, d;
-
-//  u8g_SetFont(&u8g, u8g_font_5x7);
-
-//	u8g_prepare();
-
-  u8g_SetFontRefHeightText(&u8g);
-  u8g_SetDefaultForegroundColor(&u8g);
-
-  u8g_SetFontPosTop(&u8g);
+	char coins[12];
 
+	u8g_DrawStr(p,35,5,"Please Wait...");
+	u8g_DrawStr(p,30,15,"check discount..");
+	if (check_done == TRUE)
+	{
+		if (check_result != TRANSACTION_OK)
+		{
+			u8g_DrawStr(p,40,25,"No Answer");
+		}
+		else
+		{
+			utoa(((U16_t)check_answer[0] << 8) | check_answer[1], coins, 10);
+			strcat(coins, " coins");
+			u8g_DrawStr(p,30,25,"Congrats you win");
+			u8g_DrawStr(p,40,35,coins);
+		}
+	}
+}
 
-  u8g_DrawStr(&u8g, 15, 3,"Home Menu");
+/* called by EF_void_Transaction_Poll() with the answer of the backend */
+static void check_answer_received(U8_t result, const U8_t *data, U8_t length)
+{
+	U8_t i;
+
+	check_result = result;
+	EF_void_Frame_SendEvent(FRAME_EVENT_CHECK_RESULT, result);
+	for (i = 0; i < sizeof(check_answer); i++)
+		check_answer[i] = (i < length) ? data[i] : 0;
+	check_done = TRUE;
+	EF_void_Scheduler_Wakeup(TASK_APP);
+}
 
+/* one shot callback of the welcome timer, called by EF_BOOLEAN_TimerDispatch() */
+static void welcome_elapsed(U8_t timerNumber)
+{
+	EF_void_Menu_CloseScreen();
+}
 
-  h = u8g_GetFontAscent(&u8g)-u8g_GetFontDescent(&u8g);
-  w = u8g_GetWidth(&u8g);
-  for( i = 0; i < HOME_MENU_ITEMS; i++ )
-  {
-//    d = (w-u8g_GetStrWidth(&u8g, menu_strings[i]))/2;
-    u8g_SetDefaultForegroundColor(&u8g);
-    if ( i == menu_current )
-    {
-      u8g_DrawBox(&u8g, 0, (i+2)*h+1, w, h);
-      u8g_SetDefaultBackgroundColor(&u8g);
+/* background tasks, called once per main loop until they return TRUE */
+static BOOLEAN welcome_task(void)
+{
+	/* keys are ignored until welcome_elapsed() closes the screen */
+	return FALSE;
+}
 
-    }
-//    u8g_DrawStr(&u8g, d, i*h, menu_strings[i]);
-    u8g_DrawStr(&u8g, 0, ((i+2)*h), home_menu_strings[i]);
+static BOOLEAN check_task(void)
+{
+	return check_done;
+}
 
-  }
+static BOOLEAN authentication_task(void)
+{
+	if (check_done == FALSE)
+		return FALSE;
 
+	/* stay on the result screen, the home menu is for verified users only */
+	if (check_result != TRANSACTION_OK || check_answer[0] != 1)
+		EF_void_Menu_CancelNext();
+	return TRUE;
 }
 
-
-void draw_coin_menu(void)
+static void start_check(U8_t command, u8g_draw_fn wait_screen, MENU_task_t task)
 {
-  uint8_t i, h;
-  u8g_uint_t w, d;
-
-  u8g_SetFontRefHeightText(&u8g);
-  u8g_SetDefaultForegroundColor(&u8g);
-  u8g_SetFontPosTop(&u8g);
-  u8g_DrawStr(&u8g, 15, 3,"Share Coins Menu");
-  h = u8g_GetFontAscent(&u8g)-u8g_GetFontDescent(&u8g);
-  w = u8g_GetWidth(&u8g);
-  for( i = 0; i < COINS_MENU_ITEMS; i++ )
-  {
-    u8g_SetDefaultForegroundColor(&u8g);
-    if ( i == menu_current )
-    {
-      u8g_DrawBox(&u8g, 0, (i+2)*h+1, w, h);
-      u8g_SetDefaultBackgroundColor(&u8g);
+	check_done = FALSE;
+	if (EF_BOOLEAN_Transaction_Request(command, NULL, 0, check_answer_received) == FALSE)
+	{
+		check_result = TRANSACTION_TIMED_OUT;
+		check_done = TRUE;
+	}
+	EF_void_Menu_ShowScreen(wait_screen);
+	EF_void_Menu_StartTask(task, TRUE);
+}
 
-    }
-    u8g_DrawStr(&u8g, 0, ((i+2)*h), coins_menu_strings[i]);
+/* item actions */
+static void show_memory_card(void)
+{
+	EF_void_Menu_ShowScreen(draw_memory_card);
+}
 
-  }
+static void show_clock(void)
+{
+	EF_void_Menu_ShowScreen(draw_clock);
+}
 
+static void check_authentication(void)
+{
+	start_check(CMD_AUTHENTICATE, draw_authentication, authentication_task);
 }
 
+static void check_discount(void)
+{
+	start_check(CMD_GET_DISCOUNT, draw_discount, check_task);
+}
 
 
+/* fonts and bitmaps of the scenes pushed by the host, selected by index */
+static const u8g_fntpgm_uint8_t * const scene_fonts[] = { u8g_font_profont10 };
+static const SCENE_bitmap_str scene_bitmaps[] = {
+	{ 28, 28, (const u8g_pgm_uint8_t *)tools_28_bits },
+	{ 28, 28, (const u8g_pgm_uint8_t *)clock_28_bits },
+	{ 28, 28, (const u8g_pgm_uint8_t *)memory_card_28_bits },
+};
+
+
+/* menu tables, all in program memory */
+static const char coins_title[] PROGMEM = "Share Coins Menu";
+static const char coins_item_1[] PROGMEM = "1) Enter Customer Pin";
+static const char coins_item_2[] PROGMEM = "2) Enter Customer Code ";
+static const char coins_item_3[] PROGMEM = "3) Check Customer Discount  ";
+static const char coins_item_4[] PROGMEM = "4) Thank you";
+
+static const MENU_item_str coins_items[] PROGMEM = {
+	{ coins_item_1, NULL, NULL },
+	{ coins_item_2, NULL, NULL },
+	{ coins_item_3, check_discount, NULL },
+	{ coins_item_4, NULL, NULL },
+};
+static const MENU_node_str coins_menu PROGMEM = { coins_title, coins_items, sizeof(coins_items)/sizeof(coins_items[0]) };
+
+static const char home_title[] PROGMEM = "Home Menu";
+static const char home_item_1[] PROGMEM = "1) My Services ";
+static const char home_item_2[] PROGMEM = "2) Software Update ";
+static const char home_item_3[] PROGMEM = "3) About the device";
+static const char home_item_4[] PROGMEM = "4) Shut Down";
+
+static const MENU_item_str home_items[] PROGMEM = {
+	{ home_item_1, NULL, &coins_menu },
+	{ home_item_2, NULL, NULL },
+	{ home_item_3, NULL, NULL },
+	{ home_item_4, NULL, NULL },
+};
+static const MENU_node_str home_menu PROGMEM = { home_title, home_items, sizeof(home_items)/sizeof(home_items[0]) };
+
+static const char setup_title[] PROGMEM = "Setup Menu";
+static const char setup_item_1[] PROGMEM = "1) Enter Machine Number";
+static const char setup_item_2[] PROGMEM = "2) Enter User Name ";
+static const char setup_item_3[] PROGMEM = "3) Enter Your Password";
+static const char setup_item_4[] PROGMEM = "4) Check Authentication";
+
+static const MENU_item_str setup_items[] PROGMEM = {
+	{ setup_item_1, show_memory_card, NULL },
+	{ setup_item_2, NULL, NULL },
+	{ setup_item_3, show_clock, NULL },
+	{ setup_item_4, check_authentication, &home_menu },
+};
+static const MENU_node_str setup_menu PROGMEM = { setup_title, setup_items, sizeof(setup_items)/sizeof(setup_items[0]) };
+
+
+
+/* the tasks sleep until their event: a queued key, a received byte, an
+ * expired timer or a due render. the hooks below run in the ISRs */
+static void wake_input(void)
+{
+	EF_void_Scheduler_Wakeup(TASK_INPUT);
+}
 
+static void wake_comms(void)
+{
+	EF_void_Scheduler_Wakeup(TASK_COMMS);
+}
 
+static void wake_app(void)
+{
+	EF_void_Scheduler_Wakeup(TASK_APP);
+}
 
+static void wake_display(void)
+{
+	EF_void_Scheduler_Wakeup(TASK_DISPLAY);
+}
 
+/* commands of the host, a complete scene is shown by the app task */
+static void scene_command(U8_t command, const U8_t *data, U8_t length)
+{
+	EF_void_Scene_Command(command, data, length);
+	if (command == CMD_SCENE_END)
+		EF_void_Scheduler_Wakeup(TASK_APP);
+}
 
-char update_menu(void)
+static BOOLEAN input_task(void)
 {
-	char key_selected = -1;
+	U8_t key_event;
 
-	if ( sys_key_code != KEY_NONE && last_key_code == sys_key_code )
+	while (EF_BOOLEAN_Keys_GetEvent(&key_event))
 	{
-		return -1;
+		EF_void_Frame_SendEvent(FRAME_EVENT_KEY, key_event);
+		EF_void_Menu_HandleKey(key_event);
 	}
-	last_key_code = sys_key_code;
-
-	switch ( sys_key_code )
-	{
-	case KEY_NEXT:
-		menu_current++;
-		if ( menu_current >= MENU_ITEMS )
-			menu_current = 0;
-		menu_redraw_required = 1;
-		break;
-	case KEY_PREV:
-		if ( menu_current == 0 )
-			menu_current = MENU_ITEMS;
-		menu_current--;
-		menu_redraw_required = 1;
-		break;
-
-	case KEY_SELECT:
-		key_selected =  menu_current;
-
-		break;
-
-	}//outer SW
-
-	return key_selected;
-
-
+	/* an item action may have started a background task */
+	EF_void_Scheduler_Wakeup(TASK_APP);
+	return FALSE;
+}
 
+static BOOLEAN comms_task(void)
+{
+	EF_void_Transaction_Poll();
+	/* the poll returns after an answer, the bytes behind it are still buffered */
+	return EF_BOOLEAN_UART_CheckForRxData();
 }
 
+static BOOLEAN app_task(void)
+{
+	EF_BOOLEAN_TimerDispatch();
+	EF_void_Menu_RunTask();
 
+	/* a new scene of the host is shown until a key is pressed */
+	if (EF_BOOLEAN_Menu_IsBusy() == FALSE && EF_BOOLEAN_Scene_Changed() == TRUE)
+	{
+		EF_void_Menu_ShowScreen(EF_void_Scene_Draw);
+	}
+	/* the background tasks wait for the events which wake this task */
+	return FALSE;
+}
 
+static BOOLEAN display_task(void)
+{
+	/* the display is ready ~56.5 ms after u8g_setup(): 55 ms of waits, each
+	 * rounded up to the clock step. the other tasks run meanwhile */
+	if (u8g_InitStep(&u8g) == 0)
+		return TRUE;
+
+	/* redraw requests of the last frame interval are coalesced into one render,
+	 * one page per step, the other tasks run between the pages */
+	EF_void_Menu_Render(EF_u8_Render_Poll());
+	return EF_BOOLEAN_Menu_IsRendering();
+}
 
 int main(void)
 {
-
-	enu_Dsply_stat Dislay_stat = welcom_menu_stat;
-	//	enu_setup_menu setup_menu;
-	//	enu_home_menu home
-	char item_selected = -1;
-
-
+	EF_void_TimerInit();
+	/* u8g delays follow the system tick, also the reset of the display. the
+	 * delay loops are calibrated in its power-on wait, see u8g_CalibrateDelayInWait() */
+	u8g_SetClock(EF_u32_Micros, TIMER_US_PER_COUNT);
 	u8g_setup();
-	menu_redraw_required = 1;
+	EF_void_Render_Init();
+	EF_void_Keys_Init();
+	EF_void_Transaction_Init();
+	EF_void_Scene_Init(scene_fonts, sizeof(scene_fonts)/sizeof(scene_fonts[0]),
+			scene_bitmaps, sizeof(scene_bitmaps)/sizeof(scene_bitmaps[0]));
+	EF_void_Transaction_SetCommandHandler(scene_command);
 	u8g_prepare();
-
-
-//
-//	for(;;)
-//	{
-//		sys_debounce_key();
-//		u8g_FirstPage(&u8g);
-//		if (menu_redraw_required == 1)
-//		{
-//			do{
-//				draw_menu();
-//				}while ( u8g_NextPage(&u8g) );
-//			menu_redraw_required = 0;
-//		}
-//		item_selected = update_menu();
-//		u8g_Delay(10);
-//	}
-
-
-
-	for(;;)
-	{
-		sys_debounce_key();
-
-		switch(Dislay_stat)
-		{
-		case welcom_menu_stat:
-			u8g_FirstPage(&u8g);
-			do{
-				U8g_welcom();
-			}while ( u8g_NextPage(&u8g) );
-			Dislay_stat = setup_menu_stat;
-			_delay_ms(3000);
-			break;
-		case setup_menu_stat:
-
-			if (menu_redraw_required == 1)
-			{
-				u8g_FirstPage(&u8g);
-				do
-				{
-					draw_menu();
-				} while ( u8g_NextPage(&u8g) );
-			}
-			/* setup menus action  */
-
-			switch(item_selected)
-			{
-			case setup_machine_num:
-				u8g_FirstPage(&u8g);
-				do{
-					u8g_DrawStr(&u8g,30,5, "Memory Card");
-					u8g_DrawXBMP(&u8g,50,25,28,28,memory_card_28_bits);
-				}while ( u8g_NextPage(&u8g) );
-				break;
-			case setup_user_name:
-
-				break;
-			case setup_password:
-				u8g_FirstPage(&u8g);
-				do{
-					u8g_DrawStr(&u8g,40,5,"Clock");
-					u8g_DrawXBMP(&u8g,40,25,28,28,clock_28_bits);
-				}while ( u8g_NextPage(&u8g) );
-
-				break;
-			case setup_athntcation:
-				u8g_SetFontRefHeightExtendedText(&u8g);
-				u8g_SetDefaultForegroundColor(&u8g);
-				//			  u8g_SetFontPosTop(&u8g);
-				u8g_FirstPage(&u8g);
-				do{
-					u8g_DrawStr(&u8g,35,15,"Please Wait...");
-					u8g_DrawStr(&u8g,15,25,"check authentication ");
-					/* check the authentication here */
-					_delay_ms(100);
-					u8g_DrawStr(&u8g,35,45,"User Verified");
-					homeDisplay_flag = 1;
-
-
-				}while ( u8g_NextPage(&u8g) );
-
-				break;
-
-
-
-			}/*end SW case*/
-
-
-
-
-			if(homeDisplay_flag == 1)
-			{
-				Dislay_stat = home_menu_stat;
-				menu_redraw_required = 1;
-				menu_current = 0;
-
-				EF_void_UART_SendString("move to home menu\n");
-			}
-			else{
-				menu_redraw_required = 0;
-			}
-
-
-			break;
-
-			case home_menu_stat:
-
-
-				//EF_void_UART_SendString("home menu state\n");
-
-				/*check home display flag */
-				if(menu_redraw_required == 1)
-				{
-					EF_void_UART_SendString("draw  home menu\n");
-					u8g_prepare();
-					u8g_FirstPage(&u8g);
-					do
-					{
-						draw_home_menu();
-					} while ( u8g_NextPage(&u8g) );
-					menu_redraw_required = 0;
-
-				}
-
-				switch(item_selected)
-				{
-				case home_service:
-
-					//					Dislay_stat = sharCoin_menu_stat;
-					if(homeDisplay_flag == 1)
-					{
-						Dislay_stat = sharCoin_menu_stat;
-						menu_redraw_required = 1;
-						menu_current = 0;
-
-						EF_void_UART_SendString("move to share coins menu\n");
-					}
-					else{
-						menu_redraw_required = 0;
-					}
-
-
-
-					break;
-				case home_SwUpdate:
-					break;
-				case home_device:
-					break;
-				case home_shutDown:
-					break;
-				}
-
-				break;
-
-			case sharCoin_menu_stat:
-				if (menu_redraw_required == 1)
-				{
-					u8g_prepare();
-
-					u8g_FirstPage(&u8g);
-					do
-					{
-						draw_coin_menu();
-					} while ( u8g_NextPage(&u8g) );
-					menu_redraw_required = 0;
-				}
-
-				switch(item_selected)
-				{
-				case share_customer_discont:
-
-					EF_void_UART_SendString("draw the discount points\n");
-
-					u8g_FirstPage(&u8g);
-
-					do{
-					u8g_DrawStr(&u8g,35,5,"Please Wait...");
-					u8g_DrawStr(&u8g,30,15,"check discount..");
-					/* check the authentication here */
-					_delay_ms(200);
-					u8g_DrawStr(&u8g,30,25,"Congrats you win");
-					u8g_DrawStr(&u8g,40,35,"120 coins");
-
-//					homeDisplay_flag = 1;
-
-
-					}while ( u8g_NextPage(&u8g) );
-
-				}
-
-				break;  /* */
-				}
-
-
-//				break;
-
-
-				item_selected = update_menu();
-
-
-				u8g_Delay(50);
-
-		}/*end Super loop*/
-
-
-
-
+	EF_void_Mirror_Enable(&u8g, MIRROR_AT_STARTUP);
+
+	EF_void_Menu_Init(&u8g, &setup_menu);
+
+	/* welcome screen for three seconds, then the setup menu */
+	EF_void_TimerCreate(THREE_SEC_TIMER_ID, 3000/SYSTEMTICKTIME);
+	EF_void_TimerSetCallback(THREE_SEC_TIMER_ID, welcome_elapsed, TIMER_MODE_ONE_SHOT | TIMER_MODE_DEFERRED);
+	EF_void_TimerStart(THREE_SEC_TIMER_ID);
+	EF_void_Menu_ShowScreen(draw_welcome);
+	EF_void_Menu_StartTask(welcome_task, FALSE);
+
+	EF_void_Scheduler_Init();
+	EF_void_Scheduler_AddTask(TASK_INPUT, input_task);
+	EF_void_Scheduler_AddTask(TASK_COMMS, comms_task);
+	EF_void_Scheduler_AddTask(TASK_APP, app_task);
+	EF_void_Scheduler_AddTask(TASK_DISPLAY, display_task);
+
+	/* no polling on the tick, the tasks are woken by their events */
+	EF_void_Keys_SetEventHook(wake_input);
+	EF_void_UART_SetRxHook(wake_comms);
+	EF_void_Scheduler_WakeOnTimer(TASK_COMMS, TRANSACTION_TIMER_ID, TIMER_MODE_PERIODIC);
+	EF_void_TimerSetDispatchHook(wake_app);
+	EF_void_Scheduler_WakeOnTimer(TASK_APP, MENU_TIMER_ID, TIMER_MODE_PERIODIC);
+	EF_void_Render_SetReadyHook(wake_display);
+
+	/* the CPU sleeps until an interrupt wakes a task */
+	EF_void_Scheduler_Run();
+
+	return 0;
 }
@@ -1,16 +1,6 @@
 
 
 
-typedef enum
-{
-	welcom_menu_stat,
-	setup_menu_stat,
-	home_menu_stat,
-	sharCoin_menu_stat,
-
-}enu_Dsply_stat;
-
-
 typedef enum
 {
 	setup_machine_num = 0,
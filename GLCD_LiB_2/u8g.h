@@ -164,6 +164,9 @@ typedef struct _u8g_dev_arg_pixel_t u8g_dev_arg_pixel_t;
 typedef struct _u8g_dev_arg_bbx_t u8g_dev_arg_bbx_t;
 typedef struct _u8g_box_t u8g_box_t;
 typedef struct _u8g_dev_arg_irgb_t u8g_dev_arg_irgb_t;
+typedef struct _u8g_point_t u8g_point_t;
+typedef struct _u8g_dev_arg_pixels_t u8g_dev_arg_pixels_t;
+typedef struct _u8g_canvas_t u8g_canvas_t;
 
 
 /*===============================================================*/
@@ -392,9 +395,34 @@ struct _u8g_dev_arg_pixel_t
   uint8_t color;			/* color or index value, red value for true color mode */
   uint8_t hi_color;		/* high byte for 64K color mode, low byte is in "color", green value for true color mode */
   uint8_t blue;			/* blue value in true color mode */
+  uint8_t rop;			/* raster operation, one of U8G_ROP_xxx */
 };
 /* typedef struct _u8g_dev_arg_pixel_t u8g_dev_arg_pixel_t; */ /* forward decl */
 
+struct _u8g_point_t
+{
+  u8g_uint_t x, y;
+};
+/* typedef struct _u8g_point_t u8g_point_t; */ /* forward decl */
+
+struct _u8g_dev_arg_pixels_t
+{
+  const u8g_point_t *pts;	/* list of points, not modified */
+  uint8_t cnt;			/* number of points in the list */
+  u8g_dev_arg_pixel_t *arg_pixel;	/* color of the points, x and y are modified by the fallback procedure */
+};
+/* typedef struct _u8g_dev_arg_pixels_t u8g_dev_arg_pixels_t; */ /* forward decl */
+
+/* 
+  raster operations for the pixel argument, honoured by the pb8h1 page buffer 
+  "s" is the color index of the drawn pixel, "d" the current value in the page buffer
+*/
+#define U8G_ROP_SET 0		/* d = s, default */
+#define U8G_ROP_CLEAR 1		/* d = 0 */
+#define U8G_ROP_XOR 2		/* d = d ^ s */
+#define U8G_ROP_ANDNOT 3		/* d = d & ~s */
+#define U8G_ROP_COPY 4		/* d = color within the pixel mask, internal use by u8g_Draw8PixelMask(), see U8G_DEV_MSG_IS_ROP_COPY */
+
 /* range for r,g,b: 0..255 */
 #define U8G_GET_HICOLOR_BY_RGB(r,g,b) (((uint16_t)((r)&0x0f8))<<8)|(((uint16_t)((g)&0x0fc))<<3)|(((uint16_t)((b)>>3)))
 
@@ -427,6 +455,21 @@ struct _u8g_dev_arg_irgb_t
 #define U8G_DEV_MSG_SLEEP_ON            16
 #define U8G_DEV_MSG_SLEEP_OFF            17
 
+/* arg: pointer to uint8_t, combination of U8G_TRANSFORM_xxx, applied by the device when the page is flushed */
+#define U8G_DEV_MSG_SET_TRANSFORM            18
+
+#define U8G_TRANSFORM_NONE 0
+#define U8G_TRANSFORM_MIRROR_X 1		/* flip left/right */
+#define U8G_TRANSFORM_MIRROR_Y 2		/* flip top/bottom */
+#define U8G_TRANSFORM_INVERT 4		/* invert all pixel */
+#define U8G_TRANSFORM_TRANSPOSE 8		/* exchange x and y, width and height are exchanged */
+#define U8G_TRANSFORM_ROT90 (U8G_TRANSFORM_TRANSPOSE|U8G_TRANSFORM_MIRROR_X)
+#define U8G_TRANSFORM_ROT180 (U8G_TRANSFORM_MIRROR_X|U8G_TRANSFORM_MIRROR_Y)
+#define U8G_TRANSFORM_ROT270 (U8G_TRANSFORM_TRANSPOSE|U8G_TRANSFORM_MIRROR_Y)
+
+/* arg: u8g_page_hook_fn, called by the device with each page before it is flushed, NULL: off */
+#define U8G_DEV_MSG_SET_PAGE_HOOK            19
+
 #define U8G_DEV_MSG_PAGE_FIRST                  20
 #define U8G_DEV_MSG_PAGE_NEXT                    21
 
@@ -437,6 +480,14 @@ struct _u8g_dev_arg_irgb_t
 /* arg: u8g_box_t *, fill structure with current page properties */
 #define U8G_DEV_MSG_GET_PAGE_BOX 23
 
+/* advance to the next page without writing the current page, the display keeps its content */
+/* return value like U8G_DEV_MSG_PAGE_NEXT, devices which do not know this msg do not advance */
+#define U8G_DEV_MSG_PAGE_SKIP 24
+
+/* continue an init sequence which runs in the background, returns 1 if the device is ready */
+/* devices which do not know this msg are ready after U8G_DEV_MSG_INIT */
+#define U8G_DEV_MSG_INIT_STEP 25
+
 /*
 #define U8G_DEV_MSG_PRIMITIVE_START             30
 #define U8G_DEV_MSG_PRIMITIVE_END               31
@@ -447,6 +498,11 @@ struct _u8g_dev_arg_irgb_t
 #define U8G_DEV_MSG_SET_4TPIXEL			45
 
 #define U8G_DEV_MSG_SET_PIXEL                           50
+/* arg: u8g_dev_arg_pixels_t * */
+#define U8G_DEV_MSG_SET_PIXELS                          51
+/* arg: pointer to uint8_t, set to 1 by devices which handle U8G_ROP_COPY with U8G_DEV_MSG_SET_8PIXEL */
+/* devices which do not know this msg leave the value untouched */
+#define U8G_DEV_MSG_IS_ROP_COPY                          52
 #define U8G_DEV_MSG_SET_8PIXEL                          59
 
 #define U8G_DEV_MSG_SET_COLOR_ENTRY                60
@@ -754,10 +810,18 @@ void u8g_SetPinOutput(uint8_t internal_pin_number);
 void u8g_SetPinLevel(uint8_t internal_pin_number, uint8_t level);
 void u8g_SetPinInput(uint8_t internal_pin_number);
 uint8_t u8g_GetPinLevel(uint8_t internal_pin_number);
+#if defined(__AVR__)
+/* PORTx, DDRx and PINx of the pin */
+volatile uint8_t *u8g_GetPinPortReg(uint8_t internal_pin_number);
+volatile uint8_t *u8g_GetPinDDRReg(uint8_t internal_pin_number);
+volatile uint8_t *u8g_GetPinInputReg(uint8_t internal_pin_number);
+#endif
 
 /* u8g level procedures, expect U8G_PI_xxx macro */
 void u8g_SetPIOutput(u8g_t *u8g, uint8_t pi);
 void u8g_SetPILevel(u8g_t *u8g, uint8_t pi, uint8_t level);
+void u8g_SetPIInput(u8g_t *u8g, uint8_t pi);
+uint8_t u8g_GetPILevel(u8g_t *u8g, uint8_t pi);
 
 
 /*===============================================================*/
@@ -841,6 +905,19 @@ uint8_t u8g_dev_pb16v2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
 /* u8g_pb8h1.c */
 uint8_t u8g_dev_pb8h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
+/* u8g_canvas.c: off-screen pb8h1 buffer, which covers the whole canvas in one page */
+struct _u8g_canvas_t
+{
+  u8g_pb_t pb;		/* must be the first member, dev_mem points to the canvas */
+  u8g_dev_t dev;
+};
+/* typedef struct _u8g_canvas_t u8g_canvas_t; */ /* forward decl */
+
+/* width must be a multiple of 8, buf must have width/8*height bytes (max 256) */
+void u8g_InitCanvas(u8g_canvas_t *canvas, u8g_uint_t width, u8g_uint_t height, uint8_t *buf);
+uint8_t u8g_dev_canvas_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+#define u8g_GetCanvasDev(canvas) (&((canvas)->dev))
+
 /* u8g_pb16h1.c */
 uint8_t u8g_dev_pb16h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
@@ -874,6 +951,8 @@ uint8_t u8g_dev_pbxh24_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
 
 /* cursor draw callback */
 typedef void (*u8g_draw_cursor_fn)(u8g_t *u8g);
+typedef void (*u8g_draw_fn)(u8g_t *u8g);		/* picture loop body for u8g_RenderStep() */
+typedef void (*u8g_page_hook_fn)(u8g_t *u8g, u8g_pb_t *pb);	/* see u8g_SetPageHook() */
 
 /* vertical reference point calculation callback */
 typedef u8g_uint_t (*u8g_font_calc_vref_fnptr)(u8g_t *u8g);
@@ -974,6 +1053,9 @@ struct _u8g_t
   u8g_state_cb state_cb;
   
   u8g_box_t current_page;		/* current box of the visible page */
+  
+  uint8_t render_page;		/* u8g_RenderStep(): 0 if no frame is in progress, otherwise number of finished pages plus one */
+  u8g_uint_t render_y0, render_y1;	/* u8g_RenderStep(): lines which are written, pages outside are skipped */
 
 };
 
@@ -987,8 +1069,11 @@ uint8_t u8g_call_dev_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 uint8_t u8g_InitLL(u8g_t *u8g, u8g_dev_t *dev);
 void u8g_FirstPageLL(u8g_t *u8g, u8g_dev_t *dev);
 uint8_t u8g_NextPageLL(u8g_t *u8g, u8g_dev_t *dev);
+uint8_t u8g_SkipPageLL(u8g_t *u8g, u8g_dev_t *dev);
 uint8_t u8g_SetContrastLL(u8g_t *u8g, u8g_dev_t *dev, uint8_t contrast);
 void u8g_DrawPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y);
+void u8g_DrawPixelsLL(u8g_t *u8g, u8g_dev_t *dev, const u8g_point_t *pts, uint8_t cnt);
+uint8_t u8g_dev_set_pixels_fallback(u8g_t *u8g, u8g_dev_t *dev, void *arg);	/* U8G_DEV_MSG_SET_PIXELS as a sequence of U8G_DEV_MSG_SET_PIXEL */
 void u8g_Draw8PixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel);
 void u8g_Draw4TPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel);
 uint8_t u8g_IsBBXIntersectionLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);	/* obsolete */
@@ -1013,13 +1098,22 @@ uint8_t u8g_InitRW8Bit(u8g_t *u8g, u8g_dev_t *dev, uint8_t d0, uint8_t d1, uint8
 
 void u8g_FirstPage(u8g_t *u8g);
 uint8_t u8g_NextPage(u8g_t *u8g);
+uint8_t u8g_RenderStep(u8g_t *u8g, u8g_draw_fn draw_fn);	/* draw and flush one page, returns 0 when the frame is complete */
+#define u8g_IsRenderBusy(u8g) ((u8g)->render_page != 0)
+#define u8g_RenderRestart(u8g) ((u8g)->render_page = 0)	/* next u8g_RenderStep() starts a new frame */
+void u8g_SetRenderWindow(u8g_t *u8g, u8g_uint_t y, u8g_uint_t h);	/* restrict the next frame to lines y..y+h-1 */
 uint8_t u8g_SetContrast(u8g_t *u8g, uint8_t contrast);
+void u8g_SetTransform(u8g_t *u8g, uint8_t transform);	/* transform: combination of U8G_TRANSFORM_xxx */
+void u8g_SetPageHook(u8g_t *u8g, u8g_page_hook_fn hook);	/* hook gets each page before it is flushed, NULL: off */
+uint8_t u8g_InitStep(u8g_t *u8g);	/* continue the init of the device, returns 1 if it is ready */
 void u8g_SleepOn(u8g_t *u8g);
 void u8g_SleepOff(u8g_t *u8g);
 void u8g_DrawPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y);
+void u8g_DrawPixels(u8g_t *u8g, const u8g_point_t *pts, uint8_t cnt);
 void u8g_Draw8Pixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel);
 void u8g_Draw4TPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel);
 void u8g_Draw8ColorPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t colpixel);
+void u8g_Draw8PixelMask(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t mask, uint8_t pixel);
 
 uint8_t u8g_Stop(u8g_t *u8g);
 void u8g_SetColorEntry(u8g_t *u8g, uint8_t idx, uint8_t r, uint8_t g, uint8_t b);
@@ -1029,6 +1123,9 @@ void u8g_SetHiColorByRGB(u8g_t *u8g, uint8_t r, uint8_t g, uint8_t b);
 void u8g_SetRGB(u8g_t *u8g, uint8_t r, uint8_t g, uint8_t b);
 uint8_t u8g_GetColorIndex(u8g_t *u8g);
 
+void u8g_SetDrawMode(u8g_t *u8g, uint8_t rop);		/* rop: one of U8G_ROP_xxx */
+uint8_t u8g_GetDrawMode(u8g_t *u8g);
+
 uint8_t u8g_GetDefaultForegroundColor(u8g_t *u8g);
 void u8g_SetDefaultForegroundColor(u8g_t *u8g);
 
@@ -1120,12 +1217,14 @@ u8g_uint_t u8g_DrawStr180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s)
 u8g_uint_t u8g_DrawStr270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s);
 
 u8g_uint_t u8g_DrawStrDir(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, const char *s);
+u8g_uint_t u8g_DrawStrInverse(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, const char *s);
 
 
 u8g_uint_t u8g_DrawStrP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s);
 u8g_uint_t u8g_DrawStr90P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s);
 u8g_uint_t u8g_DrawStr180P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s);
 u8g_uint_t u8g_DrawStr270P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s);
+u8g_uint_t u8g_DrawStrInverseP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, const u8g_pgm_uint8_t *s);
 
 
 void u8g_SetFontRefHeightText(u8g_t *u8g);
@@ -1181,6 +1280,9 @@ void u8g_DrawBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g
 void u8g_DrawXBM(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const uint8_t *bitmap);
 void u8g_DrawXBMP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap);
 
+/* u8g_canvas.c */
+void u8g_BitBlt(u8g_t *u8g, u8g_uint_t dx, u8g_uint_t dy, u8g_canvas_t *canvas, u8g_uint_t sx, u8g_uint_t sy, u8g_uint_t w, u8g_uint_t h, uint8_t rop);
+
 
 /* u8g_line.c */
 void u8g_DrawLine(u8g_t *u8g, u8g_uint_t x1, u8g_uint_t y1, u8g_uint_t x2, u8g_uint_t y2);
@@ -1344,6 +1446,44 @@ void u8g_MicroDelay(void);
 /* delay by 10 microseconds */
 void u8g_10MicroDelay(void);
 
+/* microseconds of a monotonic hardware clock, wraps at 2^32 */
+typedef uint32_t u8g_time_t;
+typedef u8g_time_t (*u8g_clock_fn)(void);
+
+/* 
+  use a hardware clock of the application for the delays, resolution is
+  the step of the clock in microseconds, clock = NULL uses the busy loops only
+*/
+void u8g_SetClock(u8g_clock_fn clock, uint16_t resolution);
+
+/* measure the busy loops of u8g_Delay/u8g_MicroDelay/u8g_10MicroDelay with the clock */
+void u8g_CalibrateDelay(void);
+
+/* calibrate once, if a wait of us microseconds is long enough for the measurement */
+void u8g_CalibrateDelayInWait(uint32_t us);
+
+/* 
+  non-blocking delay: u8g_DelayStart returns the deadline, u8g_DelayUntil
+  returns 1 once it is reached. Without a running clock (no clock or
+  disabled interrupts on AVR) u8g_DelayStart waits itself and 
+  u8g_DelayUntil always returns 1.
+*/
+u8g_time_t u8g_DelayStart(uint32_t us);
+uint8_t u8g_DelayUntil(u8g_time_t deadline);
+
+/* u8g_com_api.c: escape sequence which is written step by step, the delays do not block */
+struct _u8g_esc_seq_t
+{
+  const uint8_t *pos;		/* next byte of the sequence, NULL: finished */
+  u8g_time_t deadline;		/* end of the running delay */
+  uint8_t reset_delay;		/* reset is low, delay in ms after the reset goes high */
+};
+typedef struct _u8g_esc_seq_t u8g_esc_seq_t;
+
+void u8g_StartEscSeqP(u8g_esc_seq_t *seq, const uint8_t *esc_seq);
+/* write the sequence up to the next delay, returns 1 if the sequence is finished */
+uint8_t u8g_WriteEscSeqStepP(u8g_t *u8g, u8g_dev_t *dev, u8g_esc_seq_t *seq);
+
 /*===============================================================*/
 /* chessengine.c */
 #define CHESS_KEY_NONE 0
@@ -0,0 +1,186 @@
+/*
+
+  u8g_canvas.c
+
+  Universal 8bit Graphics Library
+  
+  Copyright (c) 2013, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+  
+
+  Off-screen canvas
+  
+  A canvas is a pb8h1 page buffer in RAM, which covers the complete canvas
+  area with a single page. It is used as device for a second u8g_t structure,
+  so that all u8g_Draw procedures can render into the canvas:
+  
+    uint8_t status_buf[128/8*8];
+    u8g_canvas_t status;
+    u8g_t status_u8g;
+    
+    u8g_InitCanvas(&status, 128, 8, status_buf);
+    u8g_InitComFn(&status_u8g, u8g_GetCanvasDev(&status), u8g_com_null_fn);
+    u8g_FirstPage(&status_u8g);
+    do
+    {
+      u8g_DrawStr(&status_u8g, ...);
+    } while( u8g_NextPage(&status_u8g) );
+  
+  Inside the picture loop of the display, the prepared canvas is copied 
+  with u8g_BitBlt(), which costs one 8 pixel operation per row and byte.
+  
+*/
+
+#include "u8g.h"
+
+void u8g_InitCanvas(u8g_canvas_t *canvas, u8g_uint_t width, u8g_uint_t height, uint8_t *buf)
+{
+  u8g_page_Init(&(canvas->pb.p), height, height);
+  canvas->pb.width = width;
+  canvas->pb.buf = buf;
+  canvas->dev.dev_fn = u8g_dev_canvas_fn;
+  canvas->dev.dev_mem = canvas;
+  canvas->dev.com_fn = u8g_com_null_fn;
+}
+
+static void u8g_canvas_Clear(u8g_canvas_t *canvas)
+{
+  uint8_t *ptr = (uint8_t *)canvas->pb.buf;
+  uint8_t *end_ptr = ptr;
+  /* u8g_pb_Clear() only clears one 8 pixel page */
+  end_ptr += (canvas->pb.width >> 3) * canvas->pb.p.total_height;
+  do
+  {
+    *ptr++ = 0;
+  } while( ptr != end_ptr );
+}
+
+uint8_t u8g_dev_canvas_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+  u8g_canvas_t *canvas = (u8g_canvas_t *)(dev->dev_mem);
+  switch(msg)
+  {
+    case U8G_DEV_MSG_INIT:
+      break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      u8g_canvas_Clear(canvas);
+      u8g_page_First(&(canvas->pb.p));
+      break;
+    default:
+      return u8g_dev_pb8h1_base_fn(u8g, dev, msg, arg);
+  }
+  return 1;
+}
+
+/* read 8 horizontal pixel of the canvas, starting at x, pixel right of the canvas are 0 */
+static uint8_t u8g_canvas_get8(u8g_canvas_t *canvas, u8g_uint_t x, u8g_uint_t y)
+{
+  const uint8_t *ptr = (const uint8_t *)canvas->pb.buf;
+  uint8_t bytes_per_line = canvas->pb.width >> 3;
+  uint8_t k = x >> 3;
+  uint16_t v;
+  
+  ptr += bytes_per_line * y;
+  v = ptr[k];
+  v <<= 8;
+  k++;
+  if ( k < bytes_per_line )
+    v |= ptr[k];
+  v <<= x & 7;
+  return v >> 8;
+}
+
+/*
+  copy the area (sx, sy, w, h) of the canvas to position (dx, dy) of u8g.
+  rop:
+    U8G_ROP_SET		copy, the destination area is replaced by the canvas
+    U8G_ROP_CLEAR	clear the destination area
+    U8G_ROP_XOR		invert the destination where the canvas pixel is set
+    U8G_ROP_ANDNOT	clear the destination where the canvas pixel is set
+  The source area is clipped to the canvas, an empty area draws nothing.
+  Only rows of the current page are processed.
+*/
+void u8g_BitBlt(u8g_t *u8g, u8g_uint_t dx, u8g_uint_t dy, u8g_canvas_t *canvas, u8g_uint_t sx, u8g_uint_t sy, u8g_uint_t w, u8g_uint_t h, uint8_t rop)
+{
+  u8g_uint_t j, c, y;
+  uint8_t mask, pixel;
+  uint8_t old_rop, old_color;
+  
+  /* clip the source area to the canvas */
+  if ( sx >= canvas->pb.width || sy >= canvas->pb.p.total_height )
+    return;
+  if ( w > canvas->pb.width - sx )
+    w = canvas->pb.width - sx;
+  if ( h > canvas->pb.p.total_height - sy )
+    h = canvas->pb.p.total_height - sy;
+  if ( w == 0 || h == 0 )
+    return;
+  
+  if ( u8g_IsBBXIntersection(u8g, dx, dy, w, h) == 0 )
+    return;
+  
+  old_rop = u8g->arg_pixel.rop;
+  old_color = u8g->arg_pixel.color;
+  u8g->arg_pixel.rop = rop;
+  u8g->arg_pixel.color = 1;
+  
+  for( j = 0; j < h; j++ )
+  {
+    y = dy + j;
+    /* skip rows outside of the current page */
+    if ( y < u8g->current_page.y0 || y > u8g->current_page.y1 )
+      continue;
+    /* w > 0: leave the loop before c += 8 can wrap around */
+    c = 0;
+    for(;;)
+    {
+      mask = 0x0ff;
+      if ( w - c < 8 )
+        mask <<= 8 - (w - c);
+      pixel = u8g_canvas_get8(canvas, sx + c, sy + j) & mask;
+      switch(rop)
+      {
+        case U8G_ROP_SET:
+          u8g_Draw8PixelMask(u8g, dx + c, y, mask, pixel);
+          break;
+        case U8G_ROP_CLEAR:
+          u8g_Draw8PixelMask(u8g, dx + c, y, mask, 0);
+          break;
+        default:
+          if ( pixel != 0 )
+            u8g_Draw8Pixel(u8g, dx + c, y, 0, pixel);
+          break;
+      }
+      if ( w - c <= 8 )
+        break;
+      c += 8;
+    }
+  }
+  
+  u8g->arg_pixel.rop = old_rop;
+  u8g->arg_pixel.color = old_color;
+}
@@ -171,3 +171,88 @@ uint8_t u8g_WriteEscSeqP(u8g_t *u8g, u8g_dev_t *dev, const uint8_t *esc_seq)
   return 1;
 }
 
+/*
+  Same sequence as u8g_WriteEscSeqP(), but the delays do not block: 
+  u8g_WriteEscSeqStepP() writes up to the next delay and returns. 
+  The next call continues after the delay is over.
+*/
+void u8g_StartEscSeqP(u8g_esc_seq_t *seq, const uint8_t *esc_seq)
+{
+  seq->pos = esc_seq;
+  seq->deadline = 0;
+  seq->reset_delay = 0;
+}
+
+uint8_t u8g_WriteEscSeqStepP(u8g_t *u8g, u8g_dev_t *dev, u8g_esc_seq_t *seq)
+{
+  uint8_t value;
+  
+  if ( seq->pos == NULL )
+    return 1;
+  if ( u8g_DelayUntil(seq->deadline) == 0 )
+    return 0;
+  
+  if ( seq->reset_delay != 0 )
+  {
+    u8g_SetResetHigh(u8g, dev);
+    seq->deadline = u8g_DelayStart((uint32_t)seq->reset_delay * 1000UL);
+    seq->reset_delay = 0;
+    return 0;
+  }
+  
+  for(;;)
+  {
+    value = u8g_pgm_read(seq->pos);
+    seq->pos++;
+    if ( value != 255 )
+    {
+      u8g_WriteByte(u8g, dev, value);
+      continue;
+    }
+    
+    value = u8g_pgm_read(seq->pos);
+    seq->pos++;
+    if ( value == 255 )
+    {
+      u8g_WriteByte(u8g, dev, value);
+    }
+    else if ( value == 254 )
+    {
+      seq->pos = NULL;
+      return 1;
+    }
+    else if ( value >= 0x0f0 )
+    {
+      /* not yet used, do nothing */
+    }
+    else if ( value >= 0xe0  )
+    {
+      u8g_SetAddress(u8g, dev, value & 0x0f);
+    }
+    else if ( value >= 0xd0 )
+    {
+      u8g_SetChipSelect(u8g, dev, value & 0x0f);
+    }
+    else if ( value >= 0xc0 )
+    {
+      u8g_SetResetLow(u8g, dev);
+      value &= 0x0f;
+      value <<= 4;
+      value+=2;
+      seq->reset_delay = value;
+      seq->deadline = u8g_DelayStart((uint32_t)value * 1000UL);
+      return 0;
+    }
+    else if ( value >= 0xbe )
+    {
+      /* not yet implemented */
+    }
+    else if ( value <= 127 )
+    {
+      seq->deadline = u8g_DelayStart((uint32_t)value * 1000UL);
+      /* a long wait, e.g. the power-on wait of a display, measures the delay loops */
+      u8g_CalibrateDelayInWait((uint32_t)value * 1000UL);
+      return 0;
+    }
+  }
+}
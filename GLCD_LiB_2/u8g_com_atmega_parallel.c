@@ -50,36 +50,128 @@
   u8g_Init8Bit(u8g, dev, d0, d1, d2, d3, d4, d5, d6, d7, en, cs1, cs2, di, rw, reset)
   u8g_Init8Bit(u8g, dev,  8,    9, 10, 11,   4,   5,   6,   7, 18, 14, 15, 17, 16, U8G_PIN_NONE)
 
+  If D0..D7 are bit 0..7 of one port, e.g. PN(0,0)..PN(0,7), the data byte
+  is written to the port with one store.
+
+  With a RW pin the busy flag of the controller (D7) is read before each 
+  write, the write follows as soon as the controller is ready. Without RW, 
+  or if the busy flag stays set too long, fixed delays follow each write.
+
 */
 
 #include "u8g.h"
 
 #if defined(__AVR__)
 
+/* polls of the busy flag, each one takes more than 2us: more than 2ms, clear needs 1.6ms */
+#define U8G_ATMEGA_PARALLEL_BUSY_POLLS 1000
+
+static uint8_t u8g_com_atmega_parallel_is_bf;	/* 1: wait for the busy flag, 0: fixed delays */
+static uint8_t u8g_com_atmega_parallel_di;		/* level of DI, it is changed to read the busy flag */
+
+/* registers of the data port if D0..D7 are bit 0..7 of one port, else NULL */
+static volatile uint8_t *u8g_com_atmega_parallel_port;
+static volatile uint8_t *u8g_com_atmega_parallel_ddr;
+static volatile uint8_t *u8g_com_atmega_parallel_pin;
+
+static void u8g_com_atmega_parallel_init_port(u8g_t *u8g)
+{
+  uint8_t pin = u8g->pin_list[U8G_PI_D0];
+  uint8_t i;
+  
+  u8g_com_atmega_parallel_port = NULL;
+  if ( pin == U8G_PIN_NONE || (pin & 7) != 0 )
+    return;
+  for( i = 1; i < 8; i++ )
+    if ( u8g->pin_list[U8G_PI_D0 + i] != pin + i )
+      return;
+  u8g_com_atmega_parallel_port = u8g_GetPinPortReg(pin);
+  u8g_com_atmega_parallel_ddr = u8g_GetPinDDRReg(pin);
+  u8g_com_atmega_parallel_pin = u8g_GetPinInputReg(pin);
+}
+
+static void u8g_com_atmega_parallel_data_input(u8g_t *u8g, uint8_t is_input)
+{
+  uint8_t pi;
+  if ( u8g_com_atmega_parallel_port != NULL )
+  {
+    *u8g_com_atmega_parallel_ddr = is_input ? 0 : 0x0ff;
+    return;
+  }
+  for( pi = U8G_PI_D0; pi <= U8G_PI_D7; pi++ )
+  {
+    if ( is_input )
+      u8g_SetPIInput(u8g, pi);
+    else
+      u8g_SetPIOutput(u8g, pi);
+  }
+}
+
+/* read the busy flag (DI=0, RW=1) until the controller is ready */
+static void u8g_com_atmega_parallel_wait(u8g_t *u8g)
+{
+  uint16_t cnt = U8G_ATMEGA_PARALLEL_BUSY_POLLS;
+  uint8_t busy;
+  
+  u8g_com_atmega_parallel_data_input(u8g, 1);
+  u8g_SetPILevel(u8g, U8G_PI_DI, 0);
+  u8g_SetPILevel(u8g, U8G_PI_RW, 1);
+  do
+  {
+    u8g_SetPILevel(u8g, U8G_PI_EN, 1);
+    u8g_MicroDelay(); /* data valid after 160ns */
+    if ( u8g_com_atmega_parallel_port != NULL )
+      busy = *u8g_com_atmega_parallel_pin & 0x080;
+    else
+      busy = u8g_GetPILevel(u8g, U8G_PI_D7);
+    u8g_SetPILevel(u8g, U8G_PI_EN, 0);
+    u8g_MicroDelay(); /* EN cycle time */
+    cnt--;
+  } while( busy != 0 && cnt != 0 );
+  u8g_SetPILevel(u8g, U8G_PI_RW, 0);
+  u8g_SetPILevel(u8g, U8G_PI_DI, u8g_com_atmega_parallel_di);
+  u8g_com_atmega_parallel_data_input(u8g, 0);
+  
+  /* no answer, the busy flag is not connected */
+  if ( busy != 0 )
+    u8g_com_atmega_parallel_is_bf = 0;
+}
+
 static void u8g_com_atmega_parallel_write(u8g_t *u8g, uint8_t val) U8G_NOINLINE;
 static void u8g_com_atmega_parallel_write(u8g_t *u8g, uint8_t val)
 {
+  if ( u8g_com_atmega_parallel_is_bf != 0 )
+    u8g_com_atmega_parallel_wait(u8g);
 
-  u8g_SetPILevel(u8g, U8G_PI_D0, val&1);
-  val >>= 1;
-  u8g_SetPILevel(u8g, U8G_PI_D1, val&1);
-  val >>= 1;
-  u8g_SetPILevel(u8g, U8G_PI_D2, val&1);
-  val >>= 1;
-  u8g_SetPILevel(u8g, U8G_PI_D3, val&1);
-  val >>= 1;
-  u8g_SetPILevel(u8g, U8G_PI_D4, val&1);
-  val >>= 1;
-  u8g_SetPILevel(u8g, U8G_PI_D5, val&1);
-  val >>= 1;
-  u8g_SetPILevel(u8g, U8G_PI_D6, val&1);
-  val >>= 1;
-  u8g_SetPILevel(u8g, U8G_PI_D7, val&1);
+  if ( u8g_com_atmega_parallel_port != NULL )
+  {
+    *u8g_com_atmega_parallel_port = val;
+  }
+  else
+  {
+    u8g_SetPILevel(u8g, U8G_PI_D0, val&1);
+    val >>= 1;
+    u8g_SetPILevel(u8g, U8G_PI_D1, val&1);
+    val >>= 1;
+    u8g_SetPILevel(u8g, U8G_PI_D2, val&1);
+    val >>= 1;
+    u8g_SetPILevel(u8g, U8G_PI_D3, val&1);
+    val >>= 1;
+    u8g_SetPILevel(u8g, U8G_PI_D4, val&1);
+    val >>= 1;
+    u8g_SetPILevel(u8g, U8G_PI_D5, val&1);
+    val >>= 1;
+    u8g_SetPILevel(u8g, U8G_PI_D6, val&1);
+    val >>= 1;
+    u8g_SetPILevel(u8g, U8G_PI_D7, val&1);
+  }
   
   /* EN cycle time must be 1 micro second  */
   u8g_SetPILevel(u8g, U8G_PI_EN, 1);
   u8g_MicroDelay(); /* delay by 1000ns, reference: ST7920: 140ns, SBN1661: 100ns */
   u8g_SetPILevel(u8g, U8G_PI_EN, 0);
+  if ( u8g_com_atmega_parallel_is_bf != 0 )
+    return; /* the next write waits for the busy flag */
   u8g_10MicroDelay(); /* ST7920 commands: 72us */
   u8g_10MicroDelay(); /* ST7920 commands: 72us */
 }
@@ -93,6 +185,9 @@ uint8_t u8g_com_atmega_parallel_fn(u8g_t *u8g, uint8_t msg, uint8_t arg_val, voi
       /* setup the RW pin as output and force it to low */
       u8g_SetPIOutput(u8g, U8G_PI_RW);
       u8g_SetPILevel(u8g, U8G_PI_RW, 0);
+      /* the busy flag can be read only with RW */
+      u8g_com_atmega_parallel_is_bf = ( u8g->pin_list[U8G_PI_RW] != U8G_PIN_NONE );
+      u8g_com_atmega_parallel_di = 0;
 
       u8g_SetPIOutput(u8g, U8G_PI_D0);
       u8g_SetPIOutput(u8g, U8G_PI_D1);
@@ -102,6 +197,7 @@ uint8_t u8g_com_atmega_parallel_fn(u8g_t *u8g, uint8_t msg, uint8_t arg_val, voi
       u8g_SetPIOutput(u8g, U8G_PI_D5);
       u8g_SetPIOutput(u8g, U8G_PI_D6);
       u8g_SetPIOutput(u8g, U8G_PI_D7);
+      u8g_com_atmega_parallel_init_port(u8g);
       u8g_SetPIOutput(u8g, U8G_PI_EN);
       u8g_SetPIOutput(u8g, U8G_PI_CS1);
       u8g_SetPIOutput(u8g, U8G_PI_CS2);
@@ -163,6 +259,7 @@ uint8_t u8g_com_atmega_parallel_fn(u8g_t *u8g, uint8_t msg, uint8_t arg_val, voi
       }
       break;
     case U8G_COM_MSG_ADDRESS:                     /* define cmd (arg_val = 0) or data mode (arg_val = 1) */
+      u8g_com_atmega_parallel_di = arg_val;
       u8g_SetPILevel(u8g, U8G_PI_DI, arg_val);
       break;
     case U8G_COM_MSG_RESET:
@@ -191,6 +191,22 @@ uint8_t u8g_GetPinLevel(uint8_t internal_pin_number)
   return 0;
 }
 
+/* registers of the port of the pin, to access all bits of the port at once */
+volatile uint8_t *u8g_GetPinPortReg(uint8_t internal_pin_number)
+{
+  return u8g_get_avr_io_ptr(u8g_avr_port_P, internal_pin_number>>3);
+}
+
+volatile uint8_t *u8g_GetPinDDRReg(uint8_t internal_pin_number)
+{
+  return u8g_get_avr_io_ptr(u8g_avr_ddr_P, internal_pin_number>>3);
+}
+
+volatile uint8_t *u8g_GetPinInputReg(uint8_t internal_pin_number)
+{
+  return u8g_get_avr_io_ptr(u8g_avr_pin_P, internal_pin_number>>3);
+}
+
 #elif defined (__MSP430__)
 #include <msp430.h>
 
@@ -362,6 +378,24 @@ void u8g_SetPILevel(u8g_t *u8g, uint8_t pi, uint8_t level)
     u8g_SetPinLevel(pin, level);
 }
 
+void u8g_SetPIInput(u8g_t *u8g, uint8_t pi)
+{
+  uint8_t pin;
+  pin = u8g->pin_list[pi];
+  if ( pin != U8G_PIN_NONE )
+    u8g_SetPinInput(pin);
+}
+
+/* a missing pin is read as 0 */
+uint8_t u8g_GetPILevel(u8g_t *u8g, uint8_t pi)
+{
+  uint8_t pin;
+  pin = u8g->pin_list[pi];
+  if ( pin != U8G_PIN_NONE )
+    return u8g_GetPinLevel(pin);
+  return 0;
+}
+
 #else  /* defined(U8G_WITH_PINLIST) */
 void u8g_SetPIOutput(u8g_t *u8g, uint8_t pi)
 {
@@ -371,4 +405,13 @@ void u8g_SetPILevel(u8g_t *u8g, uint8_t pi, uint8_t level)
 {
 }
 
+void u8g_SetPIInput(u8g_t *u8g, uint8_t pi)
+{
+}
+
+uint8_t u8g_GetPILevel(u8g_t *u8g, uint8_t pi)
+{
+  return 0;
+}
+
 #endif /* defined(U8G_WITH_PINLIST) */
@@ -36,12 +36,25 @@
   void u8g_MicroDelay(void)		Delay be one microsecond
   void u8g_10MicroDelay(void)	Delay by 10 microseconds
 
+  void u8g_SetClock(u8g_clock_fn clock, uint16_t resolution)
+				Use a microsecond clock of the application
+  void u8g_CalibrateDelay(void)	Measure the AVR busy loops with the clock
+  void u8g_CalibrateDelayInWait(uint32_t us)
+				Measure them once, in a wait which is long enough
+  u8g_time_t u8g_DelayStart(uint32_t us)
+  uint8_t u8g_DelayUntil(u8g_time_t deadline)
+				Non-blocking delay
+
   
 */
 
 
 #include "u8g.h"
 
+/* microsecond clock of the application, see u8g_SetClock() */
+static u8g_clock_fn u8g_clock = NULL;
+static uint16_t u8g_clock_resolution;
+
 /*==== Part 1: Derive suitable delay procedure ====*/
 
 #if defined(ARDUINO)
@@ -149,12 +162,41 @@ void u8g_10MicroDelay(void)
   ==> 7 cycles
   ==> must be devided by 4, rounded up 7/4 = 2
 */
+
+/* 
+  loop counts for _delay_loop_2, the defaults are computed from F_CPU,
+  u8g_CalibrateDelay() replaces them with measured values 
+*/
+static uint16_t u8g_delay_ms_loops = (F_CPU / 4000 ) -2;
+static uint16_t u8g_delay_us_loops = (F_CPU / 4000000 );
+static uint16_t u8g_delay_10us_loops = (F_CPU / 400000 );
+static uint8_t u8g_delay_is_calibrated = 0;
+
+/* the clock only runs with enabled interrupts */
+static uint8_t u8g_is_clock_running(void)
+{
+  return u8g_clock != NULL && (SREG & _BV(SREG_I)) != 0;
+}
+
 void u8g_Delay(uint16_t val)
 {
+  u8g_time_t start;
+  uint32_t us;
+  
+  if ( u8g_is_clock_running() )
+  {
+    /* the first step of the clock may come at once */
+    us = (uint32_t)val * 1000UL + u8g_clock_resolution;
+    start = u8g_clock();
+    while( (u8g_time_t)(u8g_clock() - start) < us )
+      ;
+    return;
+  }
+  
   /* old version did a call to the arduino lib: delay(val); */
   while( val != 0 )
   {
-    _delay_loop_2( (F_CPU / 4000 ) -2);
+    _delay_loop_2( u8g_delay_ms_loops );
     val--;
   }
 }
@@ -162,17 +204,74 @@ void u8g_Delay(uint16_t val)
 /* delay by one micro second */
 void u8g_MicroDelay(void)
 {
-#if (F_CPU / 4000000 ) > 0 
-  _delay_loop_2( (F_CPU / 4000000 ) );
-#endif
+  if ( u8g_delay_us_loops != 0 )
+    _delay_loop_2( u8g_delay_us_loops );
 }
 
 /* delay by 10 micro seconds */
 void u8g_10MicroDelay(void)
 {
-#if (F_CPU / 400000 ) > 0 
-  _delay_loop_2( (F_CPU / 400000 ) );
-#endif
+  if ( u8g_delay_10us_loops != 0 )
+    _delay_loop_2( u8g_delay_10us_loops );
+}
+
+/* number of milliseconds measured by u8g_CalibrateDelay() */
+#define U8G_DELAY_CALIBRATION_MS 32
+
+/*
+  Run U8G_DELAY_CALIBRATION_MS loops of one millisecond and compare with
+  the clock. The time of the interrupts during the loops is included, so the
+  delays are right for the running system.
+  With a clock resolution of 128us the error is below 0.5%.
+  The microsecond loops are rounded up: a short delay would violate the
+  timing of the display.
+*/
+void u8g_CalibrateDelay(void)
+{
+  u8g_time_t start;
+  uint32_t elapsed;
+  uint32_t loops;
+  uint8_t i;
+  
+  if ( u8g_is_clock_running() == 0 )
+    return;
+  
+  /* start at a step of the clock */
+  start = u8g_clock();
+  while( u8g_clock() == start )
+    ;
+  start = u8g_clock();
+  for( i = 0; i < U8G_DELAY_CALIBRATION_MS; i++ )
+    _delay_loop_2( u8g_delay_ms_loops );
+  elapsed = u8g_clock() - start;
+  if ( elapsed == 0 )
+    return;
+  
+  loops = ((uint32_t)u8g_delay_ms_loops * U8G_DELAY_CALIBRATION_MS * 1000UL) / elapsed;
+  if ( loops == 0 )
+    loops = 1;
+  if ( loops > 0x0ffff )
+    loops = 0x0ffff;
+  u8g_delay_ms_loops = loops;
+  u8g_delay_us_loops = (loops + 999) / 1000;
+  u8g_delay_10us_loops = (loops + 99) / 100;
+  u8g_delay_is_calibrated = 1;
+}
+
+/*
+  Calibrate once, in the first wait of at least us microseconds which 
+  also covers the measurement, e.g. the power-on wait of an init sequence.
+  The caller has started the wait with u8g_DelayStart().
+*/
+void u8g_CalibrateDelayInWait(uint32_t us)
+{
+  if ( u8g_delay_is_calibrated != 0 )
+    return;
+  /* the loops may be 1/8 slower than the defaults assume, the measurement 
+     starts at a step of the clock */
+  if ( us < U8G_DELAY_CALIBRATION_MS * 1125UL + u8g_clock_resolution )
+    return;
+  u8g_CalibrateDelay();
 }
 
 #endif 
@@ -308,3 +407,64 @@ void u8g_10MicroDelay(void)
 {
 }
 #endif
+
+
+/*==== Part 3: Clock based delays, all systems ====*/
+
+void u8g_SetClock(u8g_clock_fn clock, uint16_t resolution)
+{
+  u8g_clock = clock;
+  u8g_clock_resolution = resolution;
+}
+
+#if !defined(USE_AVR_DELAY)
+static uint8_t u8g_is_clock_running(void)
+{
+  return u8g_clock != NULL;
+}
+
+/* only the AVR delays are busy loops with a loop count */
+void u8g_CalibrateDelay(void)
+{
+}
+
+void u8g_CalibrateDelayInWait(uint32_t us)
+{
+}
+#endif
+
+u8g_time_t u8g_DelayStart(uint32_t us)
+{
+  if ( u8g_is_clock_running() == 0 )
+  {
+    /* wait here, u8g_DelayUntil will return 1 */
+    while( us >= 1000 )
+    {
+      u8g_Delay(1);
+      us -= 1000;
+    }
+    while( us >= 10 )
+    {
+      u8g_10MicroDelay();
+      us -= 10;
+    }
+    while( us > 0 )
+    {
+      u8g_MicroDelay();
+      us--;
+    }
+    return 0;
+  }
+  /* the first step of the clock may come at once */
+  return u8g_clock() + us + u8g_clock_resolution;
+}
+
+uint8_t u8g_DelayUntil(u8g_time_t deadline)
+{
+  if ( u8g_is_clock_running() == 0 )
+    return 1;
+  /* the difference is signed, the clock may wrap */
+  if ( (int32_t)(u8g_clock() - deadline) >= 0 )
+    return 1;
+  return 0;
+}
@@ -44,6 +44,8 @@ uint8_t u8g_dev_null(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
       break;
     case U8G_DEV_MSG_SET_PIXEL:
       break;
+    case U8G_DEV_MSG_SET_PIXELS:
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
     case U8G_DEV_MSG_INIT:
       break;
     case U8G_DEV_MSG_STOP:
@@ -61,49 +61,243 @@ static const uint8_t u8g_dev_st7920_128x64_init_seq[] PROGMEM = {
   U8G_ESC_END                /* end of sequence */
 };
 
+/* 
+  fast boot: the waits of the 8 bit init flow chart of the ST7920 datasheet,
+  about 55 ms in total. Written by u8g_WriteEscSeqStepP(), the application
+  draws after u8g_InitStep() returns 1.
+*/
+static const uint8_t u8g_dev_st7920_128x64_fast_init_seq[] PROGMEM = {
+  U8G_ESC_CS(0),             /* disable chip */
+  U8G_ESC_ADR(0),           /* instruction mode */
+  U8G_ESC_RST(0),           /* do reset low pulse with 2 milliseconds, 2 ms after it */
+  U8G_ESC_DLY(37),         /* power on: more than 40 ms after VDD, including the reset */
+  U8G_ESC_CS(1),             /* enable chip */
+
+  0x038,                                /* 8 Bit interface (DL=1), basic instruction set (RE=0) */
+  U8G_ESC_DLY(1),               /* more than 100 us */
+  0x038,                                /* function set again */
+  U8G_ESC_DLY(1),               /* more than 37 us */
+  0x00c,                                /* display on, cursor & blink off; 0x08: all off */
+  U8G_ESC_DLY(1),               /* more than 100 us */
+  0x001,                                /* clear RAM */
+  U8G_ESC_DLY(10),               /* more than 10 ms */
+  0x006,                                /* Entry mode: Cursor move to right ,DDRAM address counter (AC) plus 1, no shift */
+  0x002,                                /* disable scroll, enable CGRAM adress */
+  U8G_ESC_DLY(1),               /* return home needs 72 us */
+  
+  U8G_ESC_CS(0),             /* disable chip */
+  U8G_ESC_END                /* end of sequence */
+};
+
+/* state of the fast init sequence */
+static u8g_esc_seq_t u8g_dev_st7920_128x64_init;
+
+/* transformation which is applied while a page is written, see u8g_SetTransform() */
+static uint8_t u8g_dev_st7920_128x64_transform = U8G_TRANSFORM_NONE;
+
+/* called before a page is flushed, see u8g_SetPageHook() */
+static u8g_page_hook_fn u8g_dev_st7920_128x64_page_hook = NULL;
+
+/* bit reversed value of a nibble, used for U8G_TRANSFORM_MIRROR_X */
+static const uint8_t u8g_dev_st7920_128x64_rev_nibble[16] PROGMEM = {
+  0x00, 0x08, 0x04, 0x0c, 0x02, 0x0a, 0x06, 0x0e, 0x01, 0x09, 0x05, 0x0d, 0x03, 0x0b, 0x07, 0x0f
+};
+
+static uint8_t u8g_dev_st7920_128x64_reverse(uint8_t b)
+{
+  uint8_t r;
+  r = u8g_pgm_read(u8g_dev_st7920_128x64_rev_nibble + (b & 15));
+  r <<= 4;
+  r |= u8g_pgm_read(u8g_dev_st7920_128x64_rev_nibble + (b >> 4));
+  return r;
+}
+
+/* 8x8 bit matrix transpose: dst[j] gets column j of the 8 source lines, msb is the first line */
+static void u8g_dev_st7920_128x64_transpose8(const uint8_t *src, uint8_t bytes_per_line, uint8_t *dst)
+{
+  uint8_t i, j, b;
+  for( j = 0; j < 8; j++ )
+    dst[j] = 0;
+  for( i = 0; i < 8; i++ )
+  {
+    b = *src;
+    src += bytes_per_line;
+    for( j = 0; j < 8; j++ )
+    {
+      dst[j] <<= 1;
+      if ( b & 128 )
+        dst[j] |= 1;
+      b <<= 1;
+    }
+  }
+}
+
+/* x: horizontal position in units of 16 pixel, y: display line 0..63 */
+static void u8g_dev_st7920_128x64_set_pos(u8g_t *u8g, u8g_dev_t *dev, uint8_t x, uint8_t y)
+{
+  u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
+  u8g_WriteByte(u8g, dev, 0x03e );      /* enable extended mode */
+  if ( y >= 32 )
+  {
+    y -= 32;
+    x += 8;				/* lower half starts at x pos 128 */
+  }
+  u8g_WriteByte(u8g, dev, 0x080 | y );      /* y pos  */
+  u8g_WriteByte(u8g, dev, 0x080 | x );      /* x pos */
+  u8g_SetAddress(u8g, dev, 1);                  /* data mode */
+}
+
+/* 8 lines of 128 pixel, mirror and invert are applied line by line */
+static void u8g_dev_st7920_128x64_write_page(u8g_t *u8g, u8g_dev_t *dev, u8g_pb_t *pb)
+{
+  uint8_t line[WIDTH/8];
+  uint8_t transform = u8g_dev_st7920_128x64_transform;
+  uint8_t inv = 0;
+  uint8_t y, i, j, b;
+  uint8_t *ptr;
+  
+  if ( transform & U8G_TRANSFORM_INVERT )
+    inv = 0x0ff;
+  
+  y = pb->p.page_y0;
+  ptr = pb->buf;
+  for( i = 0; i < PAGE_HEIGHT; i ++ )
+  {
+    if ( transform & U8G_TRANSFORM_MIRROR_Y )
+      u8g_dev_st7920_128x64_set_pos(u8g, dev, 0, HEIGHT-1-y);
+    else
+      u8g_dev_st7920_128x64_set_pos(u8g, dev, 0, y);
+    
+    if ( transform == U8G_TRANSFORM_NONE )
+    {
+      u8g_WriteSequence(u8g, dev, WIDTH/8, ptr);
+    }
+    else
+    {
+      for( j = 0; j < WIDTH/8; j++ )
+      {
+        if ( transform & U8G_TRANSFORM_MIRROR_X )
+          b = u8g_dev_st7920_128x64_reverse(ptr[WIDTH/8-1-j]);
+        else
+          b = ptr[j];
+        line[j] = b ^ inv;
+      }
+      u8g_WriteSequence(u8g, dev, WIDTH/8, line);
+    }
+    ptr += WIDTH/8;
+    y++;
+  }
+}
+
+/*
+  U8G_TRANSFORM_TRANSPOSE: the page buffer is 64 pixel wide with 16 lines per page.
+  The 16 lines of a page become a 16 pixel column (one GDRAM word) of the display. 
+  Each 8x8 block of the page is transposed, then two bytes are written per display line.
+*/
+static void u8g_dev_st7920_128x64_write_transposed_page(u8g_t *u8g, u8g_dev_t *dev, u8g_pb_t *pb)
+{
+  uint8_t upper[8], lower[8], d[2];
+  uint8_t transform = u8g_dev_st7920_128x64_transform;
+  uint8_t inv = 0;
+  uint8_t x, y, i, j;
+  uint8_t *ptr = pb->buf;
+  
+  if ( transform & U8G_TRANSFORM_INVERT )
+    inv = 0x0ff;
+  
+  x = pb->p.page_y0 >> 4;
+  if ( transform & U8G_TRANSFORM_MIRROR_X )
+    x = WIDTH/16-1-x;
+  
+  for( i = 0; i < HEIGHT/8; i++ )
+  {
+    u8g_dev_st7920_128x64_transpose8(ptr + i, HEIGHT/8, upper);
+    u8g_dev_st7920_128x64_transpose8(ptr + i + HEIGHT, HEIGHT/8, lower);
+    for( j = 0; j < 8; j++ )
+    {
+      y = i*8 + j;
+      if ( transform & U8G_TRANSFORM_MIRROR_Y )
+        y = HEIGHT-1-y;
+      if ( transform & U8G_TRANSFORM_MIRROR_X )
+      {
+        d[0] = u8g_dev_st7920_128x64_reverse(lower[j]) ^ inv;
+        d[1] = u8g_dev_st7920_128x64_reverse(upper[j]) ^ inv;
+      }
+      else
+      {
+        d[0] = upper[j] ^ inv;
+        d[1] = lower[j] ^ inv;
+      }
+      u8g_dev_st7920_128x64_set_pos(u8g, dev, x, y);
+      u8g_WriteSequence(u8g, dev, 2, d);
+    }
+  }
+}
+
+/* u8g_pb_Clear() only clears 8 lines, the transposed page has 16 lines */
+static void u8g_dev_st7920_128x64_clear_transposed_page(u8g_pb_t *pb)
+{
+  uint8_t *ptr = pb->buf;
+  uint8_t i;
+  for( i = 0; i < WIDTH; i++ )
+    *ptr++ = 0;
+}
+
 uint8_t u8g_dev_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 {
+  u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
   switch(msg)
   {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
-      u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7920_128x64_init_seq);
+      /* the sequence continues with U8G_DEV_MSG_INIT_STEP */
+      u8g_StartEscSeqP(&u8g_dev_st7920_128x64_init, u8g_dev_st7920_128x64_fast_init_seq);
+      u8g_WriteEscSeqStepP(u8g, dev, &u8g_dev_st7920_128x64_init);
       break;
+    case U8G_DEV_MSG_INIT_STEP:
+      return u8g_WriteEscSeqStepP(u8g, dev, &u8g_dev_st7920_128x64_init);
     case U8G_DEV_MSG_STOP:
       break;
+    case U8G_DEV_MSG_SET_TRANSFORM:
+      u8g_dev_st7920_128x64_transform = *(uint8_t *)arg;
+      if ( u8g_dev_st7920_128x64_transform & U8G_TRANSFORM_TRANSPOSE )
+      {
+        /* same buffer size: 64 pixel x 16 lines */
+        pb->width = HEIGHT;
+        u8g_page_Init(&(pb->p), PAGE_HEIGHT*2, WIDTH);
+      }
+      else
+      {
+        pb->width = WIDTH;
+        u8g_page_Init(&(pb->p), PAGE_HEIGHT, HEIGHT);
+      }
+      return 1;
+    case U8G_DEV_MSG_SET_PAGE_HOOK:
+      u8g_dev_st7920_128x64_page_hook = (u8g_page_hook_fn)arg;
+      return 1;
+    case U8G_DEV_MSG_PAGE_FIRST:
+    case U8G_DEV_MSG_PAGE_SKIP:
+      if ( u8g_dev_st7920_128x64_transform & U8G_TRANSFORM_TRANSPOSE )
+        u8g_dev_st7920_128x64_clear_transposed_page(pb);
+      break;
     case U8G_DEV_MSG_PAGE_NEXT:
+      /* the display isn't ready yet: finish the init here */
+      while( u8g_WriteEscSeqStepP(u8g, dev, &u8g_dev_st7920_128x64_init) == 0 )
+        ;
+      if ( u8g_dev_st7920_128x64_page_hook != NULL )
+        u8g_dev_st7920_128x64_page_hook(u8g, pb);
+      u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
+      u8g_SetChipSelect(u8g, dev, 1);
+      if ( u8g_dev_st7920_128x64_transform & U8G_TRANSFORM_TRANSPOSE )
       {
-        uint8_t y, i;
-        uint8_t *ptr;
-        u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-        
-        u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
-        u8g_SetChipSelect(u8g, dev, 1);
-        y = pb->p.page_y0;
-        ptr = pb->buf;
-        for( i = 0; i < 8; i ++ )
-        {
-          u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
-          u8g_WriteByte(u8g, dev, 0x03e );      /* enable extended mode */
-
-          if ( y < 32 )
-          {
-                  u8g_WriteByte(u8g, dev, 0x080 | y );      /* y pos  */
-                  u8g_WriteByte(u8g, dev, 0x080  );      /* set x pos to 0*/
-          }
-          else
-          {
-                  u8g_WriteByte(u8g, dev, 0x080 | (y-32) );      /* y pos  */
-                  u8g_WriteByte(u8g, dev, 0x080 | 8);      /* set x pos to 64*/
-          }
-          
-          u8g_SetAddress(u8g, dev, 1);                  /* data mode */
-          u8g_WriteSequence(u8g, dev, WIDTH/8, ptr);
-          ptr += WIDTH/8;
-          y++;
-        }
-        u8g_SetChipSelect(u8g, dev, 0);
+        u8g_dev_st7920_128x64_write_transposed_page(u8g, dev, pb);
+        u8g_dev_st7920_128x64_clear_transposed_page(pb);
+      }
+      else
+      {
+        u8g_dev_st7920_128x64_write_page(u8g, dev, pb);
       }
+      u8g_SetChipSelect(u8g, dev, 0);
       break;
   }
   return u8g_dev_pb8h1_base_fn(u8g, dev, msg, arg);
@@ -119,6 +313,9 @@ uint8_t u8g_dev_st7920_128x64_4x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, voi
       break;
     case U8G_DEV_MSG_STOP:
       break;
+    case U8G_DEV_MSG_SET_PIXELS:
+      /* the 32 line page buffer only knows single pixels */
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
     case U8G_DEV_MSG_PAGE_NEXT:
       {
         uint8_t y, i;
@@ -108,6 +108,9 @@ uint8_t u8g_dev_st7920_192x32_4x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, voi
       break;
     case U8G_DEV_MSG_STOP:
       break;
+    case U8G_DEV_MSG_SET_PIXELS:
+      /* the 32 line page buffer only knows single pixels */
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
     case U8G_DEV_MSG_PAGE_NEXT:
       {
         uint8_t y, i;
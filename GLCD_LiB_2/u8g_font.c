@@ -877,6 +877,125 @@ u8g_uint_t u8g_DrawStrDir(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, c
   return 0;
 }
 
+/*
+  fetch 8 pixel of a glyph line, starting at glyph column "col".
+  col might be negative (pixel left of the glyph bbx) or beyond the glyph width,
+  pixel outside of the glyph are returned as 0.
+*/
+static uint8_t u8g_font_get_glyph_line8(const u8g_pgm_uint8_t *data, uint8_t bytes_per_line, int8_t col)
+{
+  uint16_t v = 0;
+  uint8_t k;
+  
+  if ( col <= -8 )
+    return 0;
+  
+  /* k is the index of the byte which contains "col" plus one */
+  k = (uint8_t)(col + 8) >> 3;
+  if ( k >= 1 && k <= bytes_per_line )
+    v = u8g_pgm_read(data+k-1) << 8;
+  if ( k < bytes_per_line )
+    v |= u8g_pgm_read(data+k);
+  v <<= (col & 7);
+  return v >> 8;
+}
+
+/*
+  Draw a string inside an inverted box of width w.
+  The box covers the reference height of the font (u8g_GetFontAscent() to 
+  u8g_GetFontDescent()). Each glyph cell is written opaque with u8g_Draw8PixelMask(),
+  so the background and the inverted glyph are composed in one pass instead of
+  a u8g_DrawBox() followed by u8g_DrawStr() with background color.
+  The string is clipped at x+w, the remaining part of the box is filled.
+  Returns the width of the drawn text.
+  is_pgm: s is a string in program memory (u8g_DrawStrInverseP())
+*/
+static u8g_uint_t u8g_draw_str_inverse(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, const char *s, uint8_t is_pgm)
+{
+  const u8g_pgm_uint8_t *data;
+  char ch;
+  u8g_uint_t t = 0;
+  u8g_uint_t top, iy, end;
+  uint8_t h, gh, bytes_per_line;
+  uint8_t cw, c, j, mask, pixel;
+  int8_t gx, gtop;
+  int8_t d;
+  
+  y += u8g->font_calc_vref(u8g);
+  top = y - (u8g_uint_t)(u8g_int_t)u8g->font_ref_ascent;
+  h = u8g->font_ref_ascent - u8g->font_ref_descent;
+  end = x + w;
+
+  if ( u8g_IsBBXIntersection(u8g, x, top, w, h) == 0 )
+    return 0;
+  
+  for(;;)
+  {
+    ch = is_pgm ? (char)u8g_pgm_read(s) : *s;
+    if ( ch == '\0' || t >= w )
+      break;
+    s++;
+    {
+      u8g_glyph_t g = u8g_GetGlyph(u8g, ch);
+      if ( g == NULL  )
+        continue;
+      data = u8g_font_GetGlyphDataStart(u8g->font, g);
+    }
+    d = u8g->glyph_dx;
+    if ( d <= 0 )
+      continue;
+    cw = d;
+    if ( cw > w - t )
+      cw = w - t;
+    
+    gx = u8g->glyph_x;
+    gh = u8g->glyph_height;
+    bytes_per_line = u8g->glyph_width;
+    bytes_per_line += 7;
+    bytes_per_line /= 8;
+    /* first line of the glyph bbx, relative to top */
+    gtop = u8g->font_ref_ascent - u8g->glyph_y - gh;
+    
+    if ( u8g_IsBBXIntersection(u8g, x, top, cw, h) != 0 )
+    {
+      iy = top;
+      for( j = 0; j < h; j++ )
+      {
+        for( c = 0; c < cw; c += 8 )
+        {
+          mask = 0x0ff;
+          if ( cw - c < 8 )
+            mask <<= 8 - (cw - c);
+          pixel = 0;
+          if ( (int8_t)j >= gtop && (int8_t)j < gtop + (int8_t)gh )
+            pixel = u8g_font_get_glyph_line8(data + (j - gtop)*bytes_per_line, bytes_per_line, c - gx);
+          if ( u8g->arg_pixel.color != 0 )
+            pixel = ~pixel;
+          u8g_Draw8PixelMask(u8g, x+c, iy, mask, pixel);
+        }
+        iy++;
+      }
+    }
+    x += cw;
+    t += cw;
+  }
+  
+  /* fill the rest of the box */
+  if ( x != end )
+    u8g_DrawBox(u8g, x, top, end-x, h);
+  return t;
+}
+
+u8g_uint_t u8g_DrawStrInverse(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, const char *s)
+{
+  return u8g_draw_str_inverse(u8g, x, y, w, s, 0);
+}
+
+u8g_uint_t u8g_DrawStrInverseP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, const u8g_pgm_uint8_t *s)
+{
+  return u8g_draw_str_inverse(u8g, x, y, w, (const char *)s, 1);
+}
+
 u8g_uint_t u8g_DrawStrP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s)
 {
   u8g_uint_t t = 0;
@@ -79,6 +79,20 @@ uint8_t u8g_NextPageLL(u8g_t *u8g, u8g_dev_t *dev)
   return r;
 }
 
+uint8_t u8g_SkipPageLL(u8g_t *u8g, u8g_dev_t *dev)
+{  
+  uint8_t r;
+  u8g->state_cb(U8G_STATE_MSG_BACKUP_ENV);
+  u8g->state_cb(U8G_STATE_MSG_RESTORE_U8G);
+  r = u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_PAGE_SKIP, NULL);
+  if ( r != 0 )
+  {
+    u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_GET_PAGE_BOX, &(u8g->current_page));
+  }
+  u8g->state_cb(U8G_STATE_MSG_RESTORE_ENV);
+  return r;
+}
+
 uint8_t u8g_SetContrastLL(u8g_t *u8g, u8g_dev_t *dev, uint8_t contrast)
 {  
   return u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_CONTRAST, &contrast);
@@ -92,6 +106,38 @@ void u8g_DrawPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y)
   u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_PIXEL, arg);
 }
 
+/* one device call for the whole list, the page buffer does the clipping */
+void u8g_DrawPixelsLL(u8g_t *u8g, u8g_dev_t *dev, const u8g_point_t *pts, uint8_t cnt)
+{
+  u8g_dev_arg_pixels_t arg;
+  arg.pts = pts;
+  arg.cnt = cnt;
+  arg.arg_pixel = &(u8g->arg_pixel);
+  u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_PIXELS, &arg);
+}
+
+/*
+  Devices which transform the coordinates (rotation, scale, virtual screen) or 
+  page buffers without a native list procedure use this to break down 
+  U8G_DEV_MSG_SET_PIXELS into single U8G_DEV_MSG_SET_PIXEL calls to "dev".
+*/
+uint8_t u8g_dev_set_pixels_fallback(u8g_t *u8g, u8g_dev_t *dev, void *arg)
+{
+  u8g_dev_arg_pixels_t *arg_pixels = (u8g_dev_arg_pixels_t *)arg;
+  u8g_dev_arg_pixel_t *arg_pixel = arg_pixels->arg_pixel;
+  const u8g_point_t *pt = arg_pixels->pts;
+  uint8_t cnt = arg_pixels->cnt;
+  while( cnt > 0 )
+  {
+    arg_pixel->x = pt->x;
+    arg_pixel->y = pt->y;
+    u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_PIXEL, arg_pixel);
+    pt++;
+    cnt--;
+  }
+  return 1;
+}
+
 void u8g_Draw8PixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel)
 {
   u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
@@ -162,6 +208,9 @@ static void u8g_init_data(u8g_t *u8g)
   u8g->cursor_fg_color = 1;
   u8g->cursor_encoding = 34;
   u8g->cursor_fn = (u8g_draw_cursor_fn)0;
+  u8g->render_page = 0;
+  u8g->render_y0 = 0;
+  u8g->render_y1 = (u8g_uint_t)~(u8g_uint_t)0;
 
 #if defined(U8G_WITH_PINLIST)  
   {
@@ -172,6 +221,7 @@ static void u8g_init_data(u8g_t *u8g)
 #endif
   
   u8g_SetColorIndex(u8g, 1);
+  u8g_SetDrawMode(u8g, U8G_ROP_SET);
 
   u8g_SetFontPosBaseline(u8g);
   
@@ -394,11 +444,94 @@ uint8_t u8g_NextPage(u8g_t *u8g)
   return u8g_NextPageLL(u8g, u8g->dev);
 }
 
+/*
+  Resumable picture loop: each call draws and flushes one page.
+  The first call of a frame does u8g_FirstPage(). The return value is 0
+  when the last page has been written, otherwise the number of finished 
+  pages of the current frame. This allows other work between two pages:
+  
+    if ( u8g_RenderStep(&u8g, draw) == 0 )
+      frame_done = 1;
+      
+  Pages outside of the window set by u8g_SetRenderWindow() are neither drawn 
+  nor written, the display keeps the content of the previous frame there. 
+  The window is reset to the full display when the frame is complete.
+*/
+static uint8_t u8g_render_done(u8g_t *u8g)
+{
+  u8g->render_page = 0;
+  u8g->render_y0 = 0;
+  u8g->render_y1 = (u8g_uint_t)~(u8g_uint_t)0;
+  return 0;
+}
+
+uint8_t u8g_RenderStep(u8g_t *u8g, u8g_draw_fn draw_fn)
+{
+  u8g_uint_t y0;
+  
+  if ( u8g->render_page == 0 )
+  {
+    u8g_FirstPage(u8g);
+    u8g->render_page = 1;
+  }
+  while ( u8g->current_page.y1 < u8g->render_y0 || u8g->current_page.y0 > u8g->render_y1 )
+  {
+    y0 = u8g->current_page.y0;
+    if ( u8g_SkipPageLL(u8g, u8g->dev) == 0 )
+      return u8g_render_done(u8g);
+    if ( u8g->current_page.y0 == y0 )
+      break;			/* device can not skip, draw the page */
+    u8g->render_page++;
+  }
+  draw_fn(u8g);
+  if ( u8g_NextPage(u8g) == 0 )
+    return u8g_render_done(u8g);
+  return u8g->render_page++;
+}
+
+void u8g_SetRenderWindow(u8g_t *u8g, u8g_uint_t y, u8g_uint_t h)
+{
+  u8g->render_y0 = y;
+  u8g->render_y1 = y + h - 1;
+}
+
 uint8_t u8g_SetContrast(u8g_t *u8g, uint8_t contrast)
 {
   return u8g_SetContrastLL(u8g, u8g->dev, contrast);
 }
 
+/*
+  Rotate, mirror or invert the picture when the page buffer is written to the display.
+  Unlike u8g_SetRot90() or u8g_SetScale2x2() this does not add a device to the
+  chain, all drawing procedures operate on the untransformed page buffer.
+  Devices without support ignore this.
+*/
+void u8g_SetTransform(u8g_t *u8g, uint8_t transform)
+{
+  u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_TRANSFORM, &transform);
+  u8g_UpdateDimension(u8g);
+}
+
+/*
+  The hook is called with the page buffer after the page is drawn and before
+  it is written to the display, e.g. to copy the picture to another output.
+  The page buffer must not be changed. Devices without support ignore this.
+*/
+void u8g_SetPageHook(u8g_t *u8g, u8g_page_hook_fn hook)
+{
+  u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_PAGE_HOOK, (void *)hook);
+}
+
+/*
+  Some devices only start their init sequence in u8g_Init(), the delays
+  of the sequence are waited here: call this until it returns 1, then draw.
+  Pages which are drawn before finish the init and block.
+*/
+uint8_t u8g_InitStep(u8g_t *u8g)
+{
+  return u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_INIT_STEP, NULL);
+}
+
 void u8g_SleepOn(u8g_t *u8g)
 {
   u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SLEEP_ON, NULL);
@@ -415,6 +548,13 @@ void u8g_DrawPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y)
   u8g_DrawPixelLL(u8g, u8g->dev, x, y);
 }
 
+void u8g_DrawPixels(u8g_t *u8g, const u8g_point_t *pts, uint8_t cnt)
+{
+  if ( cnt == 0 )
+    return;
+  u8g_DrawPixelsLL(u8g, u8g->dev, pts, cnt);
+}
+
 void u8g_Draw8Pixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel)
 {
   u8g_Draw8PixelLL(u8g, u8g->dev, x, y, dir, pixel);
@@ -436,6 +576,44 @@ void u8g_Draw8ColorPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t colpixe
   u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_8PIXEL, arg);
 }
 
+/*
+  horizontal 8 pixel, opaque: all pixels set in "mask" are replaced by the 
+  corresponding bits of "pixel", pixels outside "mask" are not touched.
+  Page buffers which handle U8G_ROP_COPY (pb8h1) do this with one call, all
+  other devices get two calls: the set pixel with the default foreground color
+  and the cleared pixel with the default background color.
+*/
+void u8g_Draw8PixelMask(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t mask, uint8_t pixel)
+{
+  uint8_t color = u8g->arg_pixel.color;
+  uint8_t rop = u8g->arg_pixel.rop;
+  uint8_t is_rop_copy = 0;
+  
+  u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_IS_ROP_COPY, &is_rop_copy);
+  if ( is_rop_copy != 0 )
+  {
+    u8g->arg_pixel.color = pixel;
+    u8g->arg_pixel.rop = U8G_ROP_COPY;
+    u8g_Draw8PixelLL(u8g, u8g->dev, x, y, 0, mask);
+  }
+  else
+  {
+    u8g->arg_pixel.rop = U8G_ROP_SET;
+    if ( (mask & pixel) != 0 )
+    {
+      u8g->arg_pixel.color = u8g_GetDefaultForegroundColor(u8g);
+      u8g_Draw8PixelLL(u8g, u8g->dev, x, y, 0, mask & pixel);
+    }
+    if ( (mask & ~pixel) != 0 )
+    {
+      u8g->arg_pixel.color = u8g_GetDefaultBackgroundColor(u8g);
+      u8g_Draw8PixelLL(u8g, u8g->dev, x, y, 0, mask & ~pixel);
+    }
+  }
+  u8g->arg_pixel.color = color;
+  u8g->arg_pixel.rop = rop;
+}
+
 /* u8g_IsBBXIntersection() has been moved to u8g_clip.c */
 #ifdef OBSOLETE_CODE
 uint8_t u8g_IsBBXIntersection(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h)
@@ -524,6 +702,20 @@ uint8_t u8g_GetColorIndex(u8g_t *u8g)
   return u8g->arg_pixel.color;
 }
 
+/*
+  rop: raster operation for all following draw procedures, one of U8G_ROP_xxx
+  U8G_ROP_XOR inverts the pixels under a box, a second identical box restores them.
+*/
+void u8g_SetDrawMode(u8g_t *u8g, uint8_t rop)
+{
+  u8g->arg_pixel.rop = rop;
+}
+
+uint8_t u8g_GetDrawMode(u8g_t *u8g)
+{
+  return u8g->arg_pixel.rop;
+}
+
 uint8_t u8g_GetDefaultForegroundColor(u8g_t *u8g)
 {
   uint8_t mode;
@@ -58,9 +58,11 @@ void *u8g_buf_upper_limit;
 #endif
 
 void u8g_pb8h1_Init(u8g_pb_t *b, void *buf, u8g_uint_t width) U8G_NOINLINE;
-void u8g_pb8h1_set_pixel(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, uint8_t color_index) U8G_NOINLINE;
+void u8g_pb8h1_set_pixel(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, uint8_t color_index, uint8_t rop) U8G_NOINLINE;
 void u8g_pb8h1_SetPixel(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel) U8G_NOINLINE ;
+void u8g_pb8h1_SetPixels(u8g_pb_t *b, const u8g_dev_arg_pixels_t * const arg_pixels) U8G_NOINLINE;
 void u8g_pb8h1_Set8PixelStd(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) U8G_NOINLINE;
+void u8g_pb8h1_Set8PixelHoriz(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) U8G_NOINLINE;
 uint8_t u8g_dev_pb8h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
 
@@ -176,8 +178,37 @@ void u8g_pb8h1_Init(u8g_pb_t *b, void *buf, u8g_uint_t width)
   u8g_pb_Clear(b);
 }
 
+/* apply the raster operation to all pixels of "ptr" which are set in "mask" */
+static void u8g_pb8h1_rop(uint8_t *ptr, uint8_t mask, uint8_t color_index, uint8_t rop)
+{
+  switch(rop)
+  {
+    case U8G_ROP_XOR:
+      if ( color_index )
+        *ptr ^= mask;
+      break;
+    case U8G_ROP_ANDNOT:
+      if ( color_index )
+        *ptr &= ~mask;
+      break;
+    case U8G_ROP_CLEAR:
+      *ptr &= ~mask;
+      break;
+    case U8G_ROP_COPY:
+      /* color_index holds the pixel values, already aligned to mask */
+      *ptr = (*ptr & ~mask) | (color_index & mask);
+      break;
+    default:
+      if ( color_index )
+        *ptr |= mask;
+      else
+        *ptr &= ~mask;
+      break;
+  }
+}
+
 /* limitation: total buffer must not exceed 256 bytes */
-void u8g_pb8h1_set_pixel(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, uint8_t color_index)
+void u8g_pb8h1_set_pixel(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, uint8_t color_index, uint8_t rop)
 {
 #ifdef NEW_CODE
   struct u8g_pb_h1_struct s;
@@ -205,15 +236,7 @@ void u8g_pb8h1_set_pixel(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, uint8_t color_
   mask >>= x & 7;
   x >>= 3;
   ptr += x;
-  if ( color_index )
-  {
-    *ptr |= mask;
-  }
-  else
-  {
-    mask ^=0xff;
-    *ptr &= mask;
-  }
+  u8g_pb8h1_rop(ptr, mask, color_index, rop);
 #endif
 }
 
@@ -226,7 +249,26 @@ void u8g_pb8h1_SetPixel(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel
     return;
   if ( arg_pixel->x >= b->width )
     return;
-  u8g_pb8h1_set_pixel(b, arg_pixel->x, arg_pixel->y, arg_pixel->color);
+  u8g_pb8h1_set_pixel(b, arg_pixel->x, arg_pixel->y, arg_pixel->color, arg_pixel->rop);
+}
+
+/* clip the whole list against the current page in one loop */
+void u8g_pb8h1_SetPixels(u8g_pb_t *b, const u8g_dev_arg_pixels_t * const arg_pixels)
+{
+  const u8g_point_t *pt = arg_pixels->pts;
+  uint8_t cnt = arg_pixels->cnt;
+  uint8_t color_index = arg_pixels->arg_pixel->color;
+  uint8_t rop = arg_pixels->arg_pixel->rop;
+  u8g_uint_t y0 = b->p.page_y0;
+  u8g_uint_t y1 = b->p.page_y1;
+  
+  while( cnt > 0 )
+  {
+    if ( pt->y >= y0 && pt->y <= y1 && pt->x < b->width )
+      u8g_pb8h1_set_pixel(b, pt->x, pt->y, color_index, rop);
+    pt++;
+    cnt--;
+  }
 }
 
 void u8g_pb8h1_Set8PixelStd(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel)
@@ -273,6 +315,87 @@ void u8g_pb8h1_Set8PixelOpt2(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel)
   } while( pixel != 0  );  
 }
 
+/*
+  horizontal 8 pixel (dir = 0): the pixel pattern covers at most two bytes of the 
+  page buffer, so it is written with two masked byte operations instead of 8 calls
+  to u8g_pb8h1_SetPixel(). This is the path for all spans of u8g_DrawHLine() and u8g_DrawBox().
+  x might have been wrapped around (negative start position).
+*/
+void u8g_pb8h1_Set8PixelHoriz(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel)
+{
+  uint8_t *ptr = b->buf;
+  uint8_t pixel = arg_pixel->pixel;
+  uint8_t shift;
+  uint8_t color;
+  u8g_uint_t x = arg_pixel->x;
+  u8g_uint_t y = arg_pixel->y;
+  u8g_uint_t tmp;
+  
+  if ( y < b->p.page_y0 )
+    return;
+  if ( y > b->p.page_y1 )
+    return;
+  
+  y -= b->p.page_y0;
+  tmp = b->width;
+  tmp >>= 3;
+  tmp *= (uint8_t)y;
+  ptr += tmp;
+  
+  shift = x & 7;
+  color = arg_pixel->color;
+  
+  /* left byte */
+  if ( x < b->width )
+  {
+    if ( arg_pixel->rop == U8G_ROP_COPY )
+      color = arg_pixel->color >> shift;
+    u8g_pb8h1_rop(ptr + (x >> 3), pixel >> shift, color, arg_pixel->rop);
+  }
+  
+  /* right byte, only if the pattern is not byte aligned */
+  if ( shift != 0 )
+  {
+    x |= 7;
+    x++;
+    if ( x < b->width )
+    {
+      if ( arg_pixel->rop == U8G_ROP_COPY )
+        color = arg_pixel->color << (8-shift);
+      u8g_pb8h1_rop(ptr + (x >> 3), pixel << (8-shift), color, arg_pixel->rop);
+    }
+  }
+}
+
+/*
+  U8G_ROP_COPY for rotated directions: split the mask into the pixels which 
+  are set and the pixels which are cleared and draw both with U8G_ROP_SET.
+*/
+static void u8g_pb8h1_Set8PixelMaskOpt2(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel)
+{
+  uint8_t mask = arg_pixel->pixel;
+  uint8_t color = arg_pixel->color;
+  u8g_uint_t x = arg_pixel->x;
+  u8g_uint_t y = arg_pixel->y;
+  
+  arg_pixel->rop = U8G_ROP_SET;
+  arg_pixel->pixel = mask & color;
+  arg_pixel->color = 1;
+  u8g_pb8h1_Set8PixelOpt2(b, arg_pixel);
+  
+  arg_pixel->x = x;
+  arg_pixel->y = y;
+  arg_pixel->pixel = mask & ~color;
+  arg_pixel->color = 0;
+  u8g_pb8h1_Set8PixelOpt2(b, arg_pixel);
+  
+  arg_pixel->x = x;
+  arg_pixel->y = y;
+  arg_pixel->pixel = mask;
+  arg_pixel->color = color;
+  arg_pixel->rop = U8G_ROP_COPY;
+}
+
 #ifdef NEW_CODE
 static void u8g_pb8h1_Set8PixelState(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel)
 {
@@ -343,13 +466,26 @@ uint8_t u8g_dev_pb8h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg
       if ( u8g_pb_Is8PixelVisible(pb, (u8g_dev_arg_pixel_t *)arg) )
         u8g_pb8h1_Set8PixelState(pb, (u8g_dev_arg_pixel_t *)arg);
 #else
-      if ( u8g_pb_Is8PixelVisible(pb, (u8g_dev_arg_pixel_t *)arg) )
-        u8g_pb8h1_Set8PixelOpt2(pb, (u8g_dev_arg_pixel_t *)arg);
+      if ( ((u8g_dev_arg_pixel_t *)arg)->dir == 0 )
+        u8g_pb8h1_Set8PixelHoriz(pb, (u8g_dev_arg_pixel_t *)arg);
+      else if ( u8g_pb_Is8PixelVisible(pb, (u8g_dev_arg_pixel_t *)arg) )
+      {
+        if ( ((u8g_dev_arg_pixel_t *)arg)->rop == U8G_ROP_COPY )
+          u8g_pb8h1_Set8PixelMaskOpt2(pb, (u8g_dev_arg_pixel_t *)arg);
+        else
+          u8g_pb8h1_Set8PixelOpt2(pb, (u8g_dev_arg_pixel_t *)arg);
+      }
 #endif
       break;
     case U8G_DEV_MSG_SET_PIXEL:
       u8g_pb8h1_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_PIXELS:
+      u8g_pb8h1_SetPixels(pb, (u8g_dev_arg_pixels_t *)arg);
+      break;
+    case U8G_DEV_MSG_IS_ROP_COPY:
+      *((uint8_t *)arg) = 1;
+      break;
     case U8G_DEV_MSG_INIT:
       break;
     case U8G_DEV_MSG_STOP:
@@ -359,6 +495,7 @@ uint8_t u8g_dev_pb8h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg
       u8g_page_First(&(pb->p));
       break;
     case U8G_DEV_MSG_PAGE_NEXT:
+    case U8G_DEV_MSG_PAGE_SKIP:
       if ( u8g_page_Next(&(pb->p)) == 0 )
         return 0;
       u8g_pb_Clear(pb);
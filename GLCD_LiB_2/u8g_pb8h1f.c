@@ -155,6 +155,8 @@ uint8_t u8g_dev_pb8h1f_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
     case U8G_DEV_MSG_SET_PIXEL:
       u8g_pb8h1f_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_PIXELS:
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
     case U8G_DEV_MSG_INIT:
       break;
     case U8G_DEV_MSG_STOP:
@@ -164,6 +166,7 @@ uint8_t u8g_dev_pb8h1f_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
       u8g_page_First(&(pb->p));
       break;
     case U8G_DEV_MSG_PAGE_NEXT:
+    case U8G_DEV_MSG_PAGE_SKIP:
       if ( u8g_page_Next(&(pb->p)) == 0 )
         return 0;
       u8g_pb_Clear(pb);
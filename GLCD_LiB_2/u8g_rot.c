@@ -104,6 +104,9 @@ uint8_t u8g_dev_rot90_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
     case U8G_DEV_MSG_SET_XY_CB:
     */
       return u8g_call_dev_fn(u8g, rotation_chain, msg, arg);
+    case U8G_DEV_MSG_SET_PIXELS:
+      /* each point must be transformed, send them one by one through this device */
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
 #ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
     case U8G_DEV_MSG_IS_BBX_INTERSECTION:
       {
@@ -203,6 +206,9 @@ uint8_t u8g_dev_rot180_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
     case U8G_DEV_MSG_SET_XY_CB:
     */
       return u8g_call_dev_fn(u8g, rotation_chain, msg, arg);
+    case U8G_DEV_MSG_SET_PIXELS:
+      /* each point must be transformed, send them one by one through this device */
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
 #ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
     case U8G_DEV_MSG_IS_BBX_INTERSECTION:
       {
@@ -311,6 +317,9 @@ uint8_t u8g_dev_rot270_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
     case U8G_DEV_MSG_SET_XY_CB:
     */
       return u8g_call_dev_fn(u8g, rotation_chain, msg, arg);
+    case U8G_DEV_MSG_SET_PIXELS:
+      /* each point must be transformed, send them one by one through this device */
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
 #ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
     case U8G_DEV_MSG_IS_BBX_INTERSECTION:
       {
@@ -76,6 +76,11 @@ uint8_t u8g_dev_scale_2x2_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
   {
     default:
       return u8g_call_dev_fn(u8g, chain, msg, arg);
+    case U8G_DEV_MSG_SET_PIXELS:
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
+    case U8G_DEV_MSG_IS_ROP_COPY:
+      /* the scaled 8 pixel are written with the color, do not forward */
+      break;
     case U8G_DEV_MSG_GET_WIDTH:
       *((u8g_uint_t *)arg) = u8g_GetWidthLL(u8g, chain) / 2;
       break;
@@ -104,6 +104,8 @@ uint8_t u8g_dev_vs_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
 	((u8g_box_t *)arg)->y1 = 0;
       }
       return 1;
+    case U8G_DEV_MSG_SET_PIXELS:
+      return u8g_dev_set_pixels_fallback(u8g, dev, arg);
     case U8G_DEV_MSG_SET_PIXEL:
     case U8G_DEV_MSG_SET_8PIXEL:
       if ( u8g_vs_current < u8g_vs_cnt )
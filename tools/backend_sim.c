@@ -0,0 +1,247 @@
+/***************************************************************
+ *  Source File: backend_sim.c
+ *
+ *  Description: host stand-in of the backend for EF_Transaction, served on a pty
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+/* build: cc -Wall -Wextra -o backend_sim backend_sim.c
+ * usage: ./backend_sim [-c coins] [-r] [-f script]
+ * A pseudo terminal is created and its device name is printed as the first
+ * line on stdout, connect the firmware or transaction_test to it. The
+ * backend runs until stdin is closed.
+ * -c coins  : answer of CMD_GET_DISCOUNT, default 150
+ * -r        : CMD_AUTHENTICATE is answered with "not verified"
+ * -f script : one letter for each received request, what is done with it
+ *             a  answer
+ *             d  drop, no answer (the device times out and repeats)
+ *             s  answer with a wrong sequence number (the device must drop it)
+ *             requests after the end of the script are answered
+ * The frame format is described in GLCD_LiB_2/Utilities/EF_Transaction_cfg.h */
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <sys/select.h>
+
+#define STX					0x02
+#define RESPONSE_FLAG		0x80
+#define MAX_DATA			32
+
+#define CMD_AUTHENTICATE	0x01
+#define CMD_GET_DISCOUNT	0x02
+
+/* receive state machine, same as the device */
+enum { RX_WAIT_STX, RX_SEQUENCE, RX_COMMAND, RX_LENGTH, RX_DATA, RX_CHECKSUM };
+
+static int rx_state = RX_WAIT_STX;
+static uint8_t rx_sequence, rx_command, rx_length, rx_index, rx_sum;
+static uint8_t rx_data[MAX_DATA];
+
+static unsigned coins = 150;
+static int verified = 1;
+static const char *script = "";
+
+/* returns 1 when a frame with a valid checksum is complete */
+static int rx_byte(uint8_t byte)
+{
+	int complete = 0;
+
+	if(rx_state != RX_WAIT_STX && rx_state != RX_CHECKSUM)
+		rx_sum += byte;
+
+	switch(rx_state)
+	{
+	case RX_WAIT_STX:
+		if(byte == STX)
+		{
+			rx_sum = 0;
+			rx_state = RX_SEQUENCE;
+		}
+		break;
+	case RX_SEQUENCE:
+		rx_sequence = byte;
+		rx_state = RX_COMMAND;
+		break;
+	case RX_COMMAND:
+		rx_command = byte;
+		rx_state = RX_LENGTH;
+		break;
+	case RX_LENGTH:
+		rx_length = byte;
+		rx_index = 0;
+		if(rx_length > MAX_DATA)
+			rx_state = RX_WAIT_STX;
+		else if(rx_length == 0)
+			rx_state = RX_CHECKSUM;
+		else
+			rx_state = RX_DATA;
+		break;
+	case RX_DATA:
+		rx_data[rx_index++] = byte;
+		if(rx_index == rx_length)
+			rx_state = RX_CHECKSUM;
+		break;
+	default:
+		complete = ((uint8_t)(rx_sum + byte) == 0);
+		rx_state = RX_WAIT_STX;
+		break;
+	}
+	return complete;
+}
+
+static void send_frame(int fd, uint8_t sequence, uint8_t command, const uint8_t *data, uint8_t length)
+{
+	uint8_t frame[MAX_DATA + 5];
+	uint8_t sum = sequence + command + length;
+	unsigned i;
+
+	frame[0] = STX;
+	frame[1] = sequence;
+	frame[2] = command;
+	frame[3] = length;
+	for(i = 0; i < length; i++)
+	{
+		frame[4 + i] = data[i];
+		sum += data[i];
+	}
+	frame[4 + length] = (uint8_t)(0 - sum);
+	if(write(fd, frame, length + 5) != length + 5)
+		perror("backend_sim: write");
+}
+
+static void handle_request(int fd)
+{
+	uint8_t answer[2];
+	uint8_t length = 0;
+	uint8_t sequence = rx_sequence;
+	char action = 'a';
+
+	if(*script != '\0')
+		action = *script++;
+
+	switch(rx_command)
+	{
+	case CMD_AUTHENTICATE:
+		answer[0] = verified;
+		length = 1;
+		break;
+	case CMD_GET_DISCOUNT:
+		answer[0] = coins >> 8;
+		answer[1] = coins & 0xFF;
+		length = 2;
+		break;
+	default:
+		break;
+	}
+
+	fprintf(stderr, "backend_sim: seq %u cmd 0x%02X: %s\n", rx_sequence, rx_command,
+			action == 'd' ? "dropped" : action == 's' ? "wrong sequence" : "answered");
+	if(action == 'd')
+		return;
+	if(action == 's')
+		sequence--;
+	send_frame(fd, sequence, rx_command | RESPONSE_FLAG, answer, length);
+}
+
+int main(int argc, char **argv)
+{
+	struct termios tio;
+	uint8_t buf[64];
+	fd_set fds;
+	int master, slave, opt;
+	ssize_t n, i;
+
+	while((opt = getopt(argc, argv, "c:rf:")) != -1)
+	{
+		switch(opt)
+		{
+		case 'c':
+			coins = (unsigned)strtoul(optarg, NULL, 0) & 0xFFFF;
+			break;
+		case 'r':
+			verified = 0;
+			break;
+		case 'f':
+			script = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-c coins] [-r] [-f script]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	master = posix_openpt(O_RDWR | O_NOCTTY);
+	if(master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+	{
+		perror("backend_sim: pty");
+		return 1;
+	}
+	/* keep the slave open, a read of the master fails while no slave is open */
+	slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+	if(slave < 0 || tcgetattr(slave, &tio) != 0)
+	{
+		perror("backend_sim: slave");
+		return 1;
+	}
+	cfmakeraw(&tio);
+	tcsetattr(slave, TCSANOW, &tio);
+
+	printf("%s\n", ptsname(master));
+	fflush(stdout);
+
+	for(;;)
+	{
+		FD_ZERO(&fds);
+		FD_SET(master, &fds);
+		FD_SET(STDIN_FILENO, &fds);
+		if(select(master + 1, &fds, NULL, NULL, NULL) < 0)
+			break;
+		if(FD_ISSET(STDIN_FILENO, &fds))
+		{
+			/* stdin closed: done */
+			if(read(STDIN_FILENO, buf, sizeof(buf)) <= 0)
+				break;
+		}
+		if(FD_ISSET(master, &fds))
+		{
+			n = read(master, buf, sizeof(buf));
+			if(n <= 0)
+				break;
+			for(i = 0; i < n; i++)
+			{
+				if(rx_byte(buf[i]))
+					handle_request(master);
+			}
+		}
+	}
+	close(slave);
+	close(master);
+	return 0;
+}
@@ -0,0 +1,131 @@
+/***************************************************************
+ *  Source File: delay_test.c
+ *
+ *  Description: host test of the u8g delays on a fake clock
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+/* build: cc -Wall -Wextra -Wno-unused-parameter -Wno-old-style-declaration -Ihost -D__AVR__ \
+ *           -o delay_test delay_test.c ../GLCD_LiB_2/u8g_delay.c
+ * usage: ./delay_test
+ * u8g_delay.c is built with its AVR delays. _delay_loop_2() and the clock of
+ * u8g_SetClock() advance a fake time instead of waiting: one loop takes 4
+ * cycles at F_CPU, LOOP_SLOWDOWN stands for the interrupts and the call
+ * overhead on the target which the F_CPU defaults don't know about. */
+
+#include <stdio.h>
+#include <avr/io.h>
+#include <util/delay.h>
+#include "../GLCD_LiB_2/u8g.h"
+
+#define LOOP_SLOWDOWN		1.25	/* the loops are 25% slower than nominal */
+#define CLOCK_RESOLUTION	128		/* us per step, TIMER_US_PER_COUNT of the target */
+
+volatile uint8_t SREG;
+
+static double fake_us;		/* time since the start of the test */
+static unsigned failures;
+
+void _delay_loop_2(uint16_t count)
+{
+	fake_us += count * 4 * 1e6 / F_CPU * LOOP_SLOWDOWN + 1;
+}
+
+/* each reading of the clock takes 0.5 us, it steps every CLOCK_RESOLUTION us */
+static u8g_time_t fake_clock(void)
+{
+	fake_us += 0.5;
+	return (u8g_time_t)(fake_us / CLOCK_RESOLUTION) * CLOCK_RESOLUTION;
+}
+
+static void check(const char *name, double us, double min, double max)
+{
+	int ok = us >= min && us <= max;
+
+	printf("%-40s %8.1f us %s\n", name, us, ok ? "ok" : "FAILED");
+	if(!ok)
+		failures++;
+}
+
+int main(void)
+{
+	double start;
+	u8g_time_t deadline;
+
+	/* no clock yet: the F_CPU defaults are too long by LOOP_SLOWDOWN */
+	SREG = 0;
+	start = fake_us;
+	u8g_Delay(10);
+	check("u8g_Delay(10), not calibrated", fake_us - start, 12000, 13000);
+
+	/* a 10 ms wait is too short for the calibration */
+	u8g_SetClock(fake_clock, CLOCK_RESOLUTION);
+	SREG = _BV(SREG_I);
+	u8g_CalibrateDelayInWait(10000);
+	SREG = 0;
+	start = fake_us;
+	u8g_Delay(10);
+	check("u8g_Delay(10), after a short wait", fake_us - start, 12000, 13000);
+
+	/* calibrated in the power-on wait of the ST7920, then used with disabled interrupts */
+	SREG = _BV(SREG_I);
+	u8g_CalibrateDelayInWait(37000);
+	SREG = 0;
+	start = fake_us;
+	u8g_Delay(10);
+	check("u8g_Delay(10), calibrated loops", fake_us - start, 10000, 10100);
+	start = fake_us;
+	u8g_10MicroDelay();
+	check("u8g_10MicroDelay(), calibrated loops", fake_us - start, 10, 12);
+	start = fake_us;
+	u8g_MicroDelay();
+	check("u8g_MicroDelay(), calibrated loops", fake_us - start, 1, 3);
+
+	/* with enabled interrupts the clock is used, never shorter */
+	SREG = _BV(SREG_I);
+	start = fake_us;
+	u8g_Delay(10);
+	check("u8g_Delay(10), clock", fake_us - start, 10000, 10000 + 2 * CLOCK_RESOLUTION);
+
+	/* the non-blocking delay, polled every 10 us */
+	deadline = u8g_DelayStart(500);
+	start = fake_us;
+	while(u8g_DelayUntil(deadline) == 0)
+		fake_us += 10;
+	check("u8g_DelayStart(500) .. u8g_DelayUntil()", fake_us - start, 500, 500 + 2 * CLOCK_RESOLUTION);
+
+	/* without the clock u8g_DelayStart() waits itself */
+	SREG = 0;
+	start = fake_us;
+	deadline = u8g_DelayStart(500);
+	/* 10 us steps, each with the call overhead */
+	check("u8g_DelayStart(500), no clock", fake_us - start, 500, 560);
+	if(u8g_DelayUntil(deadline) == 0)
+	{
+		printf("u8g_DelayUntil() after it did not return 1 FAILED\n");
+		failures++;
+	}
+
+	printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+	return failures != 0;
+}
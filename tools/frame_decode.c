@@ -0,0 +1,295 @@
+/***************************************************************
+ *  Source File: frame_decode.c
+ *
+ *  Description: host side decoder of the EF_Frame messages
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+/* build: cc -o frame_decode frame_decode.c
+ * usage: stty -F /dev/ttyUSB0 9600 raw && ./frame_decode [-p prefix] /dev/ttyUSB0
+ *        ./frame_decode [-p prefix] < capture.bin
+ * prints one line per valid frame, the frame format is described in
+ * GLCD_LiB_2/Utilities/EF_Frame_cfg.h
+ * -p prefix: the display pages of EF_Mirror are collected, each complete
+ *            picture is written to prefixNNNN.pbm */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SLIP_END			0xC0
+#define SLIP_ESC			0xDB
+#define SLIP_ESC_END		0xDC
+#define SLIP_ESC_ESC		0xDD
+
+#define TYPE_LOG			0x01
+#define TYPE_EVENT			0x02
+#define TYPE_TELEMETRY		0x03
+#define TYPE_PAGE			0x04
+#define TYPE_FRAME_END		0x05
+
+#define EVENT_KEY			0x01
+#define EVENT_CHECK_RESULT	0x02
+
+#define MAX_FRAME			256
+
+/* picture of the display, one bit per pixel, msb is the left pixel (same as PBM) */
+#define MAX_WIDTH			256
+#define MAX_HEIGHT			256
+static uint8_t image[MAX_HEIGHT][MAX_WIDTH/8];
+static unsigned image_width, image_height;
+static unsigned long image_count;
+static const char *image_prefix;
+
+static uint16_t crc16(const uint8_t *data, size_t length)
+{
+	uint16_t crc = 0xFFFF;
+	size_t i;
+	int bit;
+
+	for(i = 0; i < length; i++)
+	{
+		crc ^= (uint16_t)data[i] << 8;
+		for(bit = 0; bit < 8; bit++)
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+	}
+	return crc;
+}
+
+/* returns the bytes used, 0 if the varint is incomplete */
+static size_t get_varint(const uint8_t *data, size_t length, uint32_t *value)
+{
+	size_t i;
+
+	*value = 0;
+	for(i = 0; i < length && i < 5; i++)
+	{
+		*value |= (uint32_t)(data[i] & 0x7F) << (7 * i);
+		if((data[i] & 0x80) == 0)
+			return i + 1;
+	}
+	return 0;
+}
+
+static const char *event_name(uint32_t event)
+{
+	switch(event)
+	{
+	case EVENT_KEY:				return "key";
+	case EVENT_CHECK_RESULT:	return "check_result";
+	default:					return "event";
+	}
+}
+
+/* unpack a PackBits compressed page into the picture */
+static int put_page(const uint8_t *data, size_t size, uint32_t y0, uint32_t lines, uint32_t width)
+{
+	uint8_t page[MAX_FRAME];
+	size_t in = 0, out = 0, n, i;
+	size_t bytes = (width / 8) * lines;
+
+	if(width == 0 || width > MAX_WIDTH || y0 + lines > MAX_HEIGHT || bytes > sizeof(page))
+		return 0;
+	while(in < size && out < bytes)
+	{
+		if(data[in] < 128)
+		{
+			n = data[in++] + 1;
+			if(in + n > size || out + n > bytes)
+				return 0;
+			memcpy(page + out, data + in, n);
+			in += n;
+			out += n;
+		}
+		else
+		{
+			n = 257 - data[in++];
+			if(in >= size || out + n > bytes)
+				return 0;
+			memset(page + out, data[in++], n);
+			out += n;
+		}
+	}
+	if(out != bytes)
+		return 0;
+	for(i = 0; i < lines; i++)
+		memcpy(image[y0 + i], page + i * (width / 8), width / 8);
+	image_width = width;
+	if(y0 + lines > image_height)
+		image_height = y0 + lines;
+	return 1;
+}
+
+static void write_image(void)
+{
+	char name[512];
+	FILE *out;
+	unsigned y;
+
+	snprintf(name, sizeof(name), "%s%04lu.pbm", image_prefix, image_count++);
+	if((out = fopen(name, "wb")) == NULL)
+	{
+		perror(name);
+		return;
+	}
+	fprintf(out, "P4\n%u %u\n", image_width, image_height);
+	for(y = 0; y < image_height; y++)
+		fwrite(image[y], 1, image_width / 8, out);
+	fclose(out);
+}
+
+static void print_frame(const uint8_t *frame, size_t length)
+{
+	const uint8_t *payload = frame + 1;
+	size_t size = length - 1;
+	size_t used;
+	uint32_t id, value;
+
+	switch(frame[0])
+	{
+	case TYPE_LOG:
+		printf("LOG %.*s\n", (int)size, (const char *)payload);
+		break;
+	case TYPE_EVENT:
+		if((used = get_varint(payload, size, &id)) == 0 ||
+				get_varint(payload + used, size - used, &value) == 0)
+		{
+			printf("EVENT (bad payload)\n");
+			break;
+		}
+		printf("EVENT %s %lu (0x%lX)\n", event_name(id), (unsigned long)value, (unsigned long)value);
+		break;
+	case TYPE_TELEMETRY:
+		printf("TELEMETRY");
+		while(size > 0)
+		{
+			if((used = get_varint(payload, size, &id)) == 0)
+				break;
+			payload += used; size -= used;
+			if((used = get_varint(payload, size, &value)) == 0)
+				break;
+			payload += used; size -= used;
+			printf(" %lu=%lu", (unsigned long)id, (unsigned long)value);
+		}
+		printf("\n");
+		break;
+	case TYPE_PAGE:
+		{
+			uint32_t y0 = 0, lines = 0, width = 0;
+			size_t header = 0;
+
+			if((used = get_varint(payload, size, &y0)) != 0)
+			{
+				header += used;
+				if((used = get_varint(payload + header, size - header, &lines)) != 0)
+				{
+					header += used;
+					if((used = get_varint(payload + header, size - header, &width)) != 0)
+						header += used;
+				}
+			}
+			if(used == 0 || !put_page(payload + header, size - header, y0, lines, width))
+			{
+				printf("PAGE (bad payload)\n");
+				break;
+			}
+			printf("PAGE y0 %lu, %lu lines, %u packed bytes\n", (unsigned long)y0, (unsigned long)lines, (unsigned)(size - header));
+		}
+		break;
+	case TYPE_FRAME_END:
+		if((used = get_varint(payload, size, &id)) == 0 ||
+				get_varint(payload + used, size - used, &value) == 0)
+		{
+			printf("FRAME_END (bad payload)\n");
+			break;
+		}
+		printf("FRAME_END %lu bytes, %lu pages not sent\n", (unsigned long)id, (unsigned long)value);
+		if(image_prefix != NULL && image_height > 0)
+			write_image();
+		break;
+	default:
+		printf("TYPE 0x%02X, %u bytes\n", frame[0], (unsigned)size);
+		break;
+	}
+	fflush(stdout);
+}
+
+int main(int argc, char **argv)
+{
+	FILE *in = stdin;
+	uint8_t frame[MAX_FRAME];
+	size_t length = 0;
+	int escaped = 0, dropped = 0;
+	unsigned long bad = 0;
+	int c;
+
+	if(argc > 2 && strcmp(argv[1], "-p") == 0)
+	{
+		image_prefix = argv[2];
+		argc -= 2;
+		argv += 2;
+	}
+	if(argc > 1 && (in = fopen(argv[1], "rb")) == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	while((c = fgetc(in)) != EOF)
+	{
+		if(c == SLIP_END)
+		{
+			/* type and crc at least */
+			if(!dropped && length >= 3)
+			{
+				if(crc16(frame, length - 2) == ((frame[length - 2] << 8) | frame[length - 1]))
+					print_frame(frame, length - 2);
+				else
+					fprintf(stderr, "crc error (%lu)\n", ++bad);
+			}
+			length = 0;
+			escaped = dropped = 0;
+			continue;
+		}
+		if(escaped)
+		{
+			escaped = 0;
+			if(c == SLIP_ESC_END)
+				c = SLIP_END;
+			else if(c == SLIP_ESC_ESC)
+				c = SLIP_ESC;
+			else
+				dropped = 1;
+		}
+		else if(c == SLIP_ESC)
+		{
+			escaped = 1;
+			continue;
+		}
+		if(length < sizeof(frame))
+			frame[length++] = (uint8_t)c;
+		else
+			dropped = 1;
+	}
+	return 0;
+}
@@ -0,0 +1,12 @@
+/* host stand-in of avr-libc <avr/interrupt.h> for the tests in tools/,
+ * ISR(vect) becomes a plain function isr_vect() which a test can call */
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#include <avr/io.h>
+
+#define ISR(vector) void isr_##vector(void)
+#define sei()
+#define cli()
+
+#endif
@@ -0,0 +1,18 @@
+/* host stand-in of avr-libc <avr/io.h> for the tests in tools/,
+ * the registers are plain variables which a test defines if it uses them */
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+#ifndef F_CPU
+#define F_CPU 8000000UL
+#endif
+
+#define _BV(bit) (1 << (bit))
+
+#define SREG_I 7
+
+extern volatile uint8_t SREG;
+
+#endif
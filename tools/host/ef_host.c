@@ -0,0 +1,119 @@
+/***************************************************************
+ *  Source File: ef_host.c
+ *
+ *  Description: host stand-ins of EF_UART and EF_SpechialTIMER for the tests in tools/
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include "ef_host.h"
+
+#include "../../GLCD_LiB_2/Utilities/EF_SpechialTIMER.h"
+
+/* EF_UART.h defines variables, it can only be included by one file of the
+ * test, which is the tested module: the prototypes are repeated here */
+void EF_void_UART_SendArray(U8_t *array, U8_t Length);
+BOOLEAN EF_BOOLEAN_UART_CheckForRxData();
+U8_t EF_u8_UART_WaitChar();
+
+volatile uint8_t SREG;
+
+int host_uart_fd = -1;
+unsigned host_sent_frames;
+U32_t host_ticks;
+
+static U32_t timer_timeout;
+static U32_t timer_start;
+static BOOLEAN timer_on;
+
+BOOLEAN host_uart_wait(long timeoutUs)
+{
+	fd_set fds;
+	struct timeval tv;
+
+	tv.tv_sec  = timeoutUs / 1000000;
+	tv.tv_usec = timeoutUs % 1000000;
+	FD_ZERO(&fds);
+	FD_SET(host_uart_fd, &fds);
+	return select(host_uart_fd + 1, &fds, NULL, NULL, &tv) > 0;
+}
+
+/**************************************************
+ * 	EF_UART
+ *************************************************/
+void EF_void_UART_SendArray(U8_t *array, U8_t Length)
+{
+	if(write(host_uart_fd, array, Length) != Length)
+		perror("ef_host: write");
+	host_sent_frames++;
+}
+
+BOOLEAN EF_BOOLEAN_UART_CheckForRxData()
+{
+	return host_uart_wait(0);
+}
+
+U8_t EF_u8_UART_WaitChar()
+{
+	U8_t byte = 0;
+
+	if(read(host_uart_fd, &byte, 1) != 1)
+		perror("ef_host: read");
+	return byte;
+}
+
+/**************************************************
+ * 	EF_SpechialTIMER
+ *************************************************/
+void EF_void_TimerCreate(U8_t timerNumber, U32_t timerTimeout)
+{
+	(void)timerNumber;
+	timer_timeout = timerTimeout;
+	timer_on = FALSE;
+}
+
+void EF_void_TimerStart(U8_t timerNumber)
+{
+	(void)timerNumber;
+	timer_start = host_ticks;
+	timer_on = TRUE;
+}
+
+void EF_void_Timer_TurnOff(U8_t timerNumber)
+{
+	(void)timerNumber;
+	timer_on = FALSE;
+}
+
+BOOLEAN EF_BOOLEAN_TimerCheck(U8_t timerNumber)
+{
+	(void)timerNumber;
+	if(timer_on == TRUE && host_ticks - timer_start >= timer_timeout)
+	{
+		timer_on = FALSE;
+		return TRUE;
+	}
+	return FALSE;
+}
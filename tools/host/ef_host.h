@@ -0,0 +1,44 @@
+/***************************************************************
+ *  Source File: ef_host.h
+ *
+ *  Description: host stand-ins of EF_UART and EF_SpechialTIMER for the tests in tools/
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+/* The UART reads and writes host_uart_fd (a pty or a pipe), the system tick
+ * is host_ticks, which the test advances. Only one timer is kept, enough for
+ * EF_Transaction. */
+
+#ifndef EF_HOST_H
+#define EF_HOST_H
+
+#include "../../GLCD_LiB_2/Utilities/std_types.h"
+
+extern int host_uart_fd;
+extern unsigned host_sent_frames;		/* calls of EF_void_UART_SendArray() */
+extern U32_t host_ticks;
+
+/* TRUE if a byte can be read from host_uart_fd within timeoutUs */
+extern BOOLEAN host_uart_wait(long timeoutUs);
+
+#endif
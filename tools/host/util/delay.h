@@ -0,0 +1,10 @@
+/* host stand-in of avr-libc <util/delay.h> for the tests in tools/,
+ * _delay_loop_2() is defined by the test, e.g. to advance a fake clock */
+#ifndef HOST_UTIL_DELAY_H
+#define HOST_UTIL_DELAY_H
+
+#include <stdint.h>
+
+extern void _delay_loop_2(uint16_t count);
+
+#endif
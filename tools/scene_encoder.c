@@ -0,0 +1,115 @@
+/***************************************************************
+ *  Source File: scene_encoder.c
+ *
+ *  Description: host side encoder of the EF_Scene draw commands
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+#include <string.h>
+#include "scene_encoder.h"
+
+void scene_encoder_init(scene_encoder_t *enc, FILE *out)
+{
+	enc->out = out;
+	enc->sequence = 0;
+}
+
+/* STX | sequence | command | length | data | checksum, the checksum is the
+ * two's complement of the sum of sequence .. last data byte */
+size_t scene_encode(scene_encoder_t *enc, uint8_t command, const uint8_t *data, size_t length)
+{
+	uint8_t frame[SCENE_MAX_DATA + 5];
+	uint8_t sum;
+	size_t i;
+
+	if(length > SCENE_MAX_DATA)
+		return 0;
+
+	enc->sequence++;
+	frame[0] = SCENE_STX;
+	frame[1] = enc->sequence;
+	frame[2] = command;
+	frame[3] = (uint8_t)length;
+	sum = frame[1] + frame[2] + frame[3];
+	for(i = 0; i < length; i++)
+	{
+		frame[4 + i] = data[i];
+		sum += data[i];
+	}
+	frame[4 + length] = (uint8_t)(0 - sum);
+
+	if(fwrite(frame, 1, length + 5, enc->out) != length + 5)
+		return 0;
+	fflush(enc->out);
+	return length + 5;
+}
+
+size_t scene_begin(scene_encoder_t *enc)
+{
+	return scene_encode(enc, SCENE_CMD_BEGIN, NULL, 0);
+}
+
+size_t scene_end(scene_encoder_t *enc)
+{
+	return scene_encode(enc, SCENE_CMD_END, NULL, 0);
+}
+
+size_t scene_set_font(scene_encoder_t *enc, uint8_t font)
+{
+	return scene_encode(enc, SCENE_CMD_SET_FONT, &font, 1);
+}
+
+/* text longer than SCENE_MAX_DATA - 2 characters is cut */
+size_t scene_draw_str(scene_encoder_t *enc, uint8_t x, uint8_t y, const char *text)
+{
+	uint8_t data[SCENE_MAX_DATA];
+	size_t length = strlen(text);
+
+	if(length > SCENE_MAX_DATA - 2)
+		length = SCENE_MAX_DATA - 2;
+	data[0] = x;
+	data[1] = y;
+	memcpy(data + 2, text, length);
+	return scene_encode(enc, SCENE_CMD_DRAW_STR, data, length + 2);
+}
+
+size_t scene_draw_box(scene_encoder_t *enc, uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+	uint8_t data[4];
+
+	data[0] = x;
+	data[1] = y;
+	data[2] = w;
+	data[3] = h;
+	return scene_encode(enc, SCENE_CMD_DRAW_BOX, data, 4);
+}
+
+size_t scene_draw_xbmp(scene_encoder_t *enc, uint8_t x, uint8_t y, uint8_t bitmap)
+{
+	uint8_t data[3];
+
+	data[0] = x;
+	data[1] = y;
+	data[2] = bitmap;
+	return scene_encode(enc, SCENE_CMD_DRAW_XBMP, data, 3);
+}
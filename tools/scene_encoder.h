@@ -0,0 +1,75 @@
+/***************************************************************
+ *  Source File: scene_encoder.h
+ *
+ *  Description: host side encoder of the EF_Scene draw commands
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+/* Builds the EF_Transaction frames of the scene commands, see
+ * GLCD_LiB_2/Utilities/EF_Scene_cfg.h and EF_Transaction_cfg.h.
+ *
+ *   scene_encoder_t enc;
+ *   scene_encoder_init(&enc, serial);
+ *   scene_begin(&enc);
+ *   scene_draw_str(&enc, 10, 10, "Hello");
+ *   scene_draw_box(&enc, 0, 30, 128, 2);
+ *   scene_end(&enc);
+ *
+ * each function returns the bytes written or 0 on error. */
+
+#ifndef SCENE_ENCODER_H
+#define SCENE_ENCODER_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#define SCENE_STX				0x02
+#define SCENE_MAX_DATA			32		/* TRANSACTION_MAX_DATA */
+
+#define SCENE_CMD_BEGIN			0x10
+#define SCENE_CMD_END			0x11
+#define SCENE_CMD_SET_FONT		0x12
+#define SCENE_CMD_DRAW_STR		0x13
+#define SCENE_CMD_DRAW_BOX		0x14
+#define SCENE_CMD_DRAW_XBMP		0x15
+
+typedef struct
+{
+	FILE *out;
+	uint8_t sequence;
+} scene_encoder_t;
+
+void scene_encoder_init(scene_encoder_t *enc, FILE *out);
+
+/* frame of any command, data may be NULL if length is 0 */
+size_t scene_encode(scene_encoder_t *enc, uint8_t command, const uint8_t *data, size_t length);
+
+size_t scene_begin(scene_encoder_t *enc);
+size_t scene_end(scene_encoder_t *enc);
+size_t scene_set_font(scene_encoder_t *enc, uint8_t font);
+size_t scene_draw_str(scene_encoder_t *enc, uint8_t x, uint8_t y, const char *text);
+size_t scene_draw_box(scene_encoder_t *enc, uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+size_t scene_draw_xbmp(scene_encoder_t *enc, uint8_t x, uint8_t y, uint8_t bitmap);
+
+#endif
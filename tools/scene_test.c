@@ -0,0 +1,233 @@
+/***************************************************************
+ *  Source File: scene_test.c
+ *
+ *  Description: loopback test of scene_encoder, EF_Transaction and EF_Scene on u8g_dev_null
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+/* build: cc -Wall -Wextra -Ihost -c scene_test.c scene_encoder.c host/ef_host.c \
+ *           ../GLCD_LiB_2/Utilities/EF_Transaction.c ../GLCD_LiB_2/Utilities/EF_Scene.c
+ *        cc -Wall -Wextra -Wno-unused-parameter -Wno-old-style-declaration -Ihost -o scene_test \
+ *           scene_test.o scene_encoder.o ef_host.o EF_Transaction.o EF_Scene.o \
+ *           ../GLCD_LiB_2/u8g_ll_api.c ../GLCD_LiB_2/u8g_clip.c ../GLCD_LiB_2/u8g_state.c \
+ *           ../GLCD_LiB_2/u8g_rect.c ../GLCD_LiB_2/u8g_bitmap.c ../GLCD_LiB_2/u8g_font.c \
+ *           ../GLCD_LiB_2/u8g_circle.c ../GLCD_LiB_2/u8g_line.c ../GLCD_LiB_2/u8g_dev_null.c \
+ *           ../GLCD_LiB_2/u8g_com_null.c ../GLCD_LiB_2/u8g_com_api.c ../GLCD_LiB_2/u8g_delay.c
+ *        (the unused parameters of the u8glib callbacks are part of their interface)
+ * usage: ./scene_test
+ * The frames of scene_encoder are written into a pipe, EF_void_Transaction_Poll()
+ * reads them and passes them to EF_void_Scene_Command(), EF_void_Scene_Draw()
+ * replays the display list on u8g_dev_null. A device in front of u8g_dev_null
+ * provides a 128x64 single page and counts the drawn pixel. */
+
+#include <stdio.h>
+#include <unistd.h>
+#include "../GLCD_LiB_2/Utilities/EF_Scene.h"
+#include "../GLCD_LiB_2/Utilities/EF_Transaction.h"
+#include "host/ef_host.h"
+#include "scene_encoder.h"
+
+/* u8g_dev_null.c has no prototype in u8g.h */
+uint8_t u8g_dev_null(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+
+#define WIDTH		128
+#define HEIGHT		64
+
+/* 8x8 bitmap of CMD_DRAW_XBMP, 32 pixel set */
+static const u8g_pgm_uint8_t checker_bits[] = { 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA };
+static const SCENE_bitmap_str bitmaps[] = { { 8, 8, checker_bits } };
+
+static unsigned long pixel_count;
+static unsigned long pixel_sum;		/* sum of x*y of the pixel, tells scenes apart */
+static unsigned failures;
+
+static void count_pixel(u8g_dev_arg_pixel_t *arg)
+{
+	u8g_uint_t x = arg->x, y = arg->y;
+	uint8_t pixel = arg->pixel;
+
+	while(pixel != 0)
+	{
+		if(pixel & 0x80)
+		{
+			pixel_count++;
+			pixel_sum += (unsigned long)(x + 1) * (y + 1);
+		}
+		pixel <<= 1;
+		switch(arg->dir)
+		{
+		case 0: x++; break;
+		case 1: y++; break;
+		case 2: x--; break;
+		default: y--; break;
+		}
+	}
+}
+
+static uint8_t count_dev_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+	switch(msg)
+	{
+	case U8G_DEV_MSG_SET_8PIXEL:
+		count_pixel((u8g_dev_arg_pixel_t *)arg);
+		break;
+	case U8G_DEV_MSG_SET_PIXEL:
+		((u8g_dev_arg_pixel_t *)arg)->pixel = 0x80;
+		((u8g_dev_arg_pixel_t *)arg)->dir = 0;
+		count_pixel((u8g_dev_arg_pixel_t *)arg);
+		break;
+	case U8G_DEV_MSG_GET_WIDTH:
+		*((u8g_uint_t *)arg) = WIDTH;
+		return 1;
+	case U8G_DEV_MSG_GET_HEIGHT:
+		*((u8g_uint_t *)arg) = HEIGHT;
+		return 1;
+	case U8G_DEV_MSG_GET_PAGE_BOX:
+		((u8g_box_t *)arg)->x0 = 0;
+		((u8g_box_t *)arg)->y0 = 0;
+		((u8g_box_t *)arg)->x1 = WIDTH - 1;
+		((u8g_box_t *)arg)->y1 = HEIGHT - 1;
+		return 1;
+	case U8G_DEV_MSG_PAGE_NEXT:
+		return 0;		/* one page only */
+	default:
+		break;
+	}
+	return u8g_dev_null(u8g, dev, msg, arg);
+}
+
+static u8g_dev_t count_dev = { count_dev_fn, NULL, u8g_com_null_fn };
+static u8g_t u8g;
+
+/* take all frames of the pipe like the main loop does */
+static void poll_frames(void)
+{
+	while(host_uart_wait(0) == TRUE)
+	{
+		EF_void_Transaction_Poll();
+	}
+}
+
+static void draw_scene(void)
+{
+	pixel_count = 0;
+	pixel_sum   = 0;
+	u8g_FirstPage(&u8g);
+	do
+	{
+		EF_void_Scene_Draw(&u8g);
+	} while(u8g_NextPage(&u8g));
+}
+
+static void send_scene_a(scene_encoder_t *enc)
+{
+	scene_begin(enc);
+	scene_draw_box(enc, 10, 10, 20, 5);		/* 100 pixel */
+	scene_draw_xbmp(enc, 40, 0, 0);			/*  32 pixel */
+	scene_set_font(enc, 7);					/* no such font, ignored */
+	scene_end(enc);
+}
+
+static void send_scene_b(scene_encoder_t *enc)
+{
+	scene_begin(enc);
+	scene_draw_box(enc, 0, 0, 10, 10);		/* 100 pixel */
+	scene_draw_box(enc, 100, 50, 3, 3);		/*   9 pixel */
+	scene_end(enc);
+}
+
+static void check(const char *name, int ok)
+{
+	printf("%-50s %s\n", name, ok ? "ok" : "FAILED");
+	if(!ok)
+		failures++;
+}
+
+int main(void)
+{
+	scene_encoder_t enc;
+	unsigned long sum_a, sum_b;
+	int fds[2];
+	FILE *out;
+	int i;
+
+	if(pipe(fds) != 0 || (out = fdopen(fds[1], "w")) == NULL)
+	{
+		perror("scene_test: pipe");
+		return 1;
+	}
+	host_uart_fd = fds[0];
+	scene_encoder_init(&enc, out);
+
+	u8g_Init(&u8g, &count_dev);
+	EF_void_Transaction_Init();
+	EF_void_Scene_Init(NULL, 0, bitmaps, sizeof(bitmaps)/sizeof(bitmaps[0]));
+	EF_void_Transaction_SetCommandHandler(EF_void_Scene_Command);
+
+	draw_scene();
+	check("empty display list draws nothing", pixel_count == 0);
+
+	send_scene_a(&enc);
+	poll_frames();
+	check("scene A: changed", EF_BOOLEAN_Scene_Changed() == TRUE);
+	check("scene A: changed is reported once", EF_BOOLEAN_Scene_Changed() == FALSE);
+	draw_scene();
+	sum_a = pixel_sum;
+	check("scene A: box and bitmap replayed", pixel_count == 100 + 32);
+
+	send_scene_a(&enc);
+	poll_frames();
+	check("scene A again: not changed", EF_BOOLEAN_Scene_Changed() == FALSE);
+	draw_scene();
+	check("scene A again: same picture", pixel_count == 100 + 32 && pixel_sum == sum_a);
+
+	send_scene_b(&enc);
+	poll_frames();
+	check("scene B: changed", EF_BOOLEAN_Scene_Changed() == TRUE);
+	draw_scene();
+	sum_b = pixel_sum;
+	check("scene B: two boxes replayed", pixel_count == 100 + 9 && sum_b != sum_a);
+
+	/* 6 bytes per box in the display list, more than SCENE_LIST_BYTES */
+	scene_begin(&enc);
+	for(i = 0; i < SCENE_LIST_BYTES/6 + 1; i++)
+	{
+		scene_draw_box(&enc, i, 0, 1, 1);
+	}
+	scene_end(&enc);
+	poll_frames();
+	check("overflowing scene: rejected", EF_BOOLEAN_Scene_Changed() == FALSE);
+	draw_scene();
+	check("overflowing scene: scene B is still shown", pixel_count == 100 + 9 && pixel_sum == sum_b);
+
+	send_scene_a(&enc);
+	poll_frames();
+	check("scene A after the overflow: changed", EF_BOOLEAN_Scene_Changed() == TRUE);
+	draw_scene();
+	check("scene A after the overflow: replayed", pixel_count == 100 + 32 && pixel_sum == sum_a);
+
+	fclose(out);
+	close(fds[0]);
+	printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+	return failures != 0;
+}
@@ -0,0 +1,184 @@
+/***************************************************************
+ *  Source File: transaction_test.c
+ *
+ *  Description: host test of EF_Transaction against backend_sim
+ *
+ *  History:     Version 1.0  - INIT Version
+ *  Date   :     19/10/2026
+ *  -------------------------------------------------------
+ *  Author :     EmbeddedFab.
+ *
+ *  Copyright (C) <2026>  <EmbeddedFab>
+
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+ **************************************************************/
+
+/* build: cc -Wall -Wextra -Ihost -o transaction_test transaction_test.c host/ef_host.c \
+ *           ../GLCD_LiB_2/Utilities/EF_Transaction.c
+ *        cc -Wall -Wextra -o backend_sim backend_sim.c
+ * usage: ./transaction_test ./backend_sim
+ * EF_UART and EF_SpechialTIMER are replaced by host/ef_host.c: the UART is
+ * the pty of backend_sim, the system tick is advanced by the test whenever
+ * the backend had 5 ms to answer. */
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <termios.h>
+#include <sys/wait.h>
+
+#include "../GLCD_LiB_2/Utilities/EF_Transaction.h"
+#include "host/ef_host.h"
+
+/* what backend_sim does with the requests of the scenarios below */
+#define BACKEND_SCRIPT		"aaddadddsa"
+#define BACKEND_COINS		"150"
+
+/**************************************************
+ * 	test
+ *************************************************/
+static BOOLEAN done;
+static U8_t result;
+static U8_t answer[TRANSACTION_MAX_DATA];
+static U8_t answer_length;
+static unsigned failures;
+
+static void answer_received(U8_t res, const U8_t *data, U8_t length)
+{
+	done = TRUE;
+	result = res;
+	answer_length = length;
+	memcpy(answer, data, length);
+}
+
+/* run one transaction like the main loop does, returns the number of sent frames */
+static unsigned run(U8_t command)
+{
+	done = FALSE;
+	host_sent_frames = 0;
+	if(EF_BOOLEAN_Transaction_Request(command, NULL, 0, answer_received) == FALSE)
+	{
+		printf("request refused\n");
+		failures++;
+		return 0;
+	}
+	/* a running transaction refuses a second request */
+	if(EF_BOOLEAN_Transaction_Request(command, NULL, 0, answer_received) == TRUE)
+	{
+		printf("second request accepted\n");
+		failures++;
+	}
+	while(done == FALSE)
+	{
+		EF_void_Transaction_Poll();
+		if(done == TRUE)
+			break;
+		if(host_uart_wait(5000) == FALSE)
+			host_ticks++;		/* nothing received within 5 ms: next system tick */
+	}
+	return host_sent_frames;
+}
+
+static void check(const char *name, int ok)
+{
+	printf("%-55s %s\n", name, ok ? "ok" : "FAILED");
+	if(!ok)
+		failures++;
+}
+
+int main(int argc, char **argv)
+{
+	int to_backend[2], from_backend[2];
+	char pty_name[128];
+	struct termios tio;
+	FILE *backend_out;
+	unsigned frames;
+	pid_t pid;
+
+	if(argc != 2)
+	{
+		fprintf(stderr, "usage: %s path/to/backend_sim\n", argv[0]);
+		return 2;
+	}
+
+	if(pipe(to_backend) != 0 || pipe(from_backend) != 0)
+		return 1;
+	pid = fork();
+	if(pid == 0)
+	{
+		dup2(to_backend[0], STDIN_FILENO);
+		dup2(from_backend[1], STDOUT_FILENO);
+		close(to_backend[1]);
+		close(from_backend[0]);
+		execl(argv[1], argv[1], "-c", BACKEND_COINS, "-f", BACKEND_SCRIPT, (char *)NULL);
+		perror("transaction_test: exec");
+		_exit(1);
+	}
+	close(to_backend[0]);
+	close(from_backend[1]);
+	backend_out = fdopen(from_backend[0], "r");
+	if(pid < 0 || backend_out == NULL || fgets(pty_name, sizeof(pty_name), backend_out) == NULL)
+	{
+		fprintf(stderr, "transaction_test: backend_sim did not start\n");
+		return 1;
+	}
+	pty_name[strcspn(pty_name, "\n")] = '\0';
+	host_uart_fd = open(pty_name, O_RDWR | O_NOCTTY);
+	if(host_uart_fd < 0 || tcgetattr(host_uart_fd, &tio) != 0)
+	{
+		perror(pty_name);
+		return 1;
+	}
+	cfmakeraw(&tio);
+	tcsetattr(host_uart_fd, TCSANOW, &tio);
+
+	EF_void_Transaction_Init();
+
+	/* script "a": answered at once */
+	frames = run(CMD_AUTHENTICATE);
+	check("authenticate: verified", result == TRANSACTION_OK && answer_length == 1 && answer[0] == 1);
+	check("authenticate: one request", frames == 1);
+
+	/* script "a" */
+	frames = run(CMD_GET_DISCOUNT);
+	check("discount: 150 coins", result == TRANSACTION_OK && answer_length == 2 &&
+			((answer[0] << 8) | answer[1]) == 150);
+	check("discount: one request", frames == 1);
+
+	/* script "dda": the second repetition is answered */
+	frames = run(CMD_AUTHENTICATE);
+	check("authenticate after two timeouts: verified", result == TRANSACTION_OK && answer[0] == 1);
+	check("authenticate after two timeouts: request repeated twice", frames == 1 + TRANSACTION_RETRIES);
+
+	/* script "ddd": all repetitions time out */
+	frames = run(CMD_GET_DISCOUNT);
+	check("discount without answer: timed out", result == TRANSACTION_TIMED_OUT && answer_length == 0);
+	check("discount without answer: all retries used", frames == 1 + TRANSACTION_RETRIES);
+
+	/* script "sa": the answer with the wrong sequence is dropped, the repetition is answered */
+	frames = run(CMD_AUTHENTICATE);
+	check("wrong sequence: dropped, repetition verified", result == TRANSACTION_OK && answer[0] == 1);
+	check("wrong sequence: request repeated once", frames == 2);
+
+	close(to_backend[1]);
+	waitpid(pid, NULL, 0);
+	printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+	return failures != 0;
+}